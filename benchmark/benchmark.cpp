@@ -1,7 +1,43 @@
+#include <atomic>
 #include <benchmark/benchmark.h>
 #include <config/config.hpp>
+#include <cstdlib>
 #include <filesystem>
+#include <new>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+
+// Counts every global heap allocation so benchmarks can report allocations per iteration.
+static std::atomic<size_t> g_allocations{0};
+
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+// GCC flags free() inside a replaced operator delete once it is inlined into new-expressions.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 
 // BM_Get: read a pre-set int key (Manual save = pure memory)
 static void BM_Get(benchmark::State &state)
@@ -16,6 +52,359 @@ static void BM_Get(benchmark::State &state)
 }
 BENCHMARK(BM_Get);
 
+// BM_GetAllocations: heap allocations per read of a short key, on a hit and on a miss
+static void BM_GetAllocations(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_allocs.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("server/port", 42);
+    const char *key      = state.range(0) != 0 ? "server/port" : "server/missing";
+    const size_t before  = g_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>(key, 0));
+    }
+    state.counters["allocs_per_iter"] = static_cast<double>(g_allocations.load(std::memory_order_relaxed) - before) /
+                                        static_cast<double>(state.iterations());
+    std::filesystem::remove("bm_get_allocs.json");
+}
+BENCHMARK(BM_GetAllocations)->Arg(1)->Arg(0);
+
+// BM_GetMissThrow / BM_GetMissDefault / BM_TryGetMiss: read a missing key through the
+// throwing policy, the default-value overload, and the exception-free try_get()
+static void BM_GetMissThrow(benchmark::State &state)
+{
+    config::ConfigStore store("bm_miss_throw.json", config::Path::Relative, config::SaveStrategy::Manual,
+                              config::MissingKeyPolicy::ThrowException);
+    store.set("server/port", 42);
+    for (auto _ : state)
+    {
+        try
+        {
+            benchmark::DoNotOptimize(store.get<int>("server/missing"));
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+    }
+    std::filesystem::remove("bm_miss_throw.json");
+}
+BENCHMARK(BM_GetMissThrow);
+
+static void BM_GetMissDefault(benchmark::State &state)
+{
+    config::ConfigStore store("bm_miss_default.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("server/port", 42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("server/missing", 0));
+    }
+    std::filesystem::remove("bm_miss_default.json");
+}
+BENCHMARK(BM_GetMissDefault);
+
+static void BM_TryGetMiss(benchmark::State &state)
+{
+    config::ConfigStore store("bm_try_miss.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("server/port", 42);
+    const size_t before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.try_get<int>("server/missing"));
+    }
+    state.counters["allocs_per_iter"] = static_cast<double>(g_allocations.load(std::memory_order_relaxed) - before) /
+                                        static_cast<double>(state.iterations());
+    std::filesystem::remove("bm_try_miss.json");
+}
+BENCHMARK(BM_TryGetMiss);
+
+// BM_GetCompiledKey: same read as BM_Get through a pre-parsed key handle
+static void BM_GetCompiledKey(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_key.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("key", 42);
+    const auto key = store.compile_key<int>("key");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get(key));
+    }
+    std::filesystem::remove("bm_get_key.json");
+}
+BENCHMARK(BM_GetCompiledKey);
+
+// BM_GetNestedStringKey / BM_GetStaticKey: read a depth-4 key from a string literal,
+// scanning it at run time, or through config::key, whose segments are split at compile time
+static void BM_GetNestedStringKey(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_nested.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("app/server/http/port", 42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("app/server/http/port"));
+    }
+    std::filesystem::remove("bm_get_nested.json");
+}
+BENCHMARK(BM_GetNestedStringKey);
+
+static void BM_GetStaticKey(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_static.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("app/server/http/port", 42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>(CONFIG_KEY("app/server/http/port")));
+    }
+    std::filesystem::remove("bm_get_static.json");
+}
+BENCHMARK(BM_GetStaticKey);
+
+// BM_GetKeysSeparately / BM_GetMany: read 10 keys with one get() each vs one get_many()
+static std::vector<config::ConfigStore::Key<int>> many_keys(config::ConfigStore &store)
+{
+    std::vector<config::ConfigStore::Key<int>> keys;
+    for (int i = 0; i < 10; ++i)
+    {
+        store.set("handler/k" + std::to_string(i), i);
+        keys.push_back(store.compile_key<int>("handler/k" + std::to_string(i)));
+    }
+    return keys;
+}
+
+static void BM_GetKeysSeparately(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_separately.json", config::Path::Relative, config::SaveStrategy::Manual);
+    const auto keys = many_keys(store);
+    for (auto _ : state)
+    {
+        for (const auto &key : keys)
+            benchmark::DoNotOptimize(store.get(key));
+    }
+    std::filesystem::remove("bm_get_separately.json");
+}
+BENCHMARK(BM_GetKeysSeparately);
+
+static void BM_GetMany(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_many.json", config::Path::Relative, config::SaveStrategy::Manual);
+    const auto keys = many_keys(store);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get_many(std::span(keys)));
+    }
+    std::filesystem::remove("bm_get_many.json");
+}
+BENCHMARK(BM_GetMany);
+
+// BM_LiveLoad: same value as BM_Get read through a live<int>() handle
+static void BM_LiveLoad(benchmark::State &state)
+{
+    config::ConfigStore store("bm_live.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("key", 42);
+    const auto value = store.live<int>("key");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value.load());
+    }
+    std::filesystem::remove("bm_live.json");
+}
+BENCHMARK(BM_LiveLoad);
+
+// BM_GetScalarSlot / BM_GetScalarSlotThreads: same read as BM_GetCompiledKey through a
+// register_scalar() key, served from a seqlock slot without touching the store mutex
+static void BM_GetScalarSlot(benchmark::State &state)
+{
+    config::ConfigStore store("bm_get_slot.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("key", 42);
+    const auto key = store.register_scalar<int>("key");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get(key));
+    }
+    std::filesystem::remove("bm_get_slot.json");
+}
+BENCHMARK(BM_GetScalarSlot);
+
+static void BM_GetScalarSlotThreads(benchmark::State &state)
+{
+    static config::ConfigStore store("bm_get_slot_threads.json", config::Path::Relative,
+                                     config::SaveStrategy::Manual);
+    static const auto key = [] {
+        store.set("key", 42);
+        return store.register_scalar<int>("key");
+    }();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get(key));
+    }
+}
+BENCHMARK(BM_GetScalarSlotThreads)->Threads(8)->UseRealTime();
+
+// BM_GetLockedThreads / BM_GetSnapshotThreads: concurrent readers on one shared store
+static config::ConfigStore &concurrent_store(config::Concurrency mode)
+{
+    const auto make_options = [](config::Concurrency concurrency) {
+        config::StoreOptions opts;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.concurrency = concurrency;
+        return opts;
+    };
+    static config::ConfigStore locked("bm_concurrent_locked.json", make_options(config::Concurrency::Locked));
+    static config::ConfigStore snapshot("bm_concurrent_snapshot.json", make_options(config::Concurrency::Snapshot));
+    auto &store = mode == config::Concurrency::Snapshot ? snapshot : locked;
+    (void)store.get_or_set("key", 42);
+    return store;
+}
+
+static void BM_GetLockedThreads(benchmark::State &state)
+{
+    auto &store = concurrent_store(config::Concurrency::Locked);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("key"));
+    }
+}
+BENCHMARK(BM_GetLockedThreads)->Threads(8)->UseRealTime();
+
+static void BM_GetSnapshotThreads(benchmark::State &state)
+{
+    auto &store = concurrent_store(config::Concurrency::Snapshot);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("key"));
+    }
+}
+BENCHMARK(BM_GetSnapshotThreads)->Threads(8)->UseRealTime();
+
+// BM_SectionWritesThreads: each thread writes and reads back a counter in its own top-level
+// section.  Locked mode (Arg 0) serializes every writer on the store mutex; Striped mode (Arg 1)
+// only serializes writers of the same section.
+static void BM_SectionWritesThreads(benchmark::State &state)
+{
+    const auto make_store = [](config::Concurrency concurrency, const char *file) {
+        config::StoreOptions opts;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.concurrency = concurrency;
+        auto store       = std::make_unique<config::ConfigStore>(file, opts);
+        for (int t = 0; t < 8; ++t)
+            store->set("section" + std::to_string(t) + "/counter", 0);
+        return store;
+    };
+    static const auto locked  = make_store(config::Concurrency::Locked, "bm_sections_locked.json");
+    static const auto striped = make_store(config::Concurrency::Striped, "bm_sections_striped.json");
+    auto &store               = state.range(0) == 0 ? *locked : *striped;
+    const std::string key     = "section" + std::to_string(state.thread_index() % 8) + "/counter";
+    int i                     = 0;
+    for (auto _ : state)
+    {
+        store.set(key, ++i);
+        benchmark::DoNotOptimize(store.get<int>(key));
+    }
+}
+BENCHMARK(BM_SectionWritesThreads)->Arg(0)->Arg(1)->Threads(4)->UseRealTime();
+
+// BM_GetStruct: read a vector<std::string> key, converting from JSON on every call
+// (Arg 0) or serving repeat reads from the conversion cache (Arg 1)
+static void BM_GetStruct(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save              = config::SaveStrategy::Manual;
+    opts.cache_conversions = state.range(0) != 0;
+    config::ConfigStore store("bm_get_struct.json", opts);
+    store.set("hosts", std::vector<std::string>{"alpha.example.com", "beta.example.com", "gamma.example.com"});
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<std::vector<std::string>>("hosts"));
+    }
+    std::filesystem::remove("bm_get_struct.json");
+}
+BENCHMARK(BM_GetStruct)->Arg(0)->Arg(1);
+
+// BM_GetDeepIndexed: read a depth-5 key from a config with ~50k leaves, walking
+// the tree (Arg 0) or probing the flat path index (Arg 1)
+static void BM_GetDeepIndexed(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save        = config::SaveStrategy::Manual;
+    opts.index_paths = state.range(0) != 0;
+    config::ConfigStore store("bm_get_deep.json", opts);
+    nlohmann::json tree;
+    for (int a = 0; a < 50; ++a)
+        for (int b = 0; b < 1000; ++b)
+            tree["section" + std::to_string(a)]["group"]["sub"]["leaf"]["entry" + std::to_string(b)] = b;
+    store.merge(tree);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("section42/group/sub/leaf/entry777"));
+    }
+    state.counters["index_entries"] = static_cast<double>(store.index_stats().entries);
+    std::filesystem::remove("bm_get_deep.json");
+}
+BENCHMARK(BM_GetDeepIndexed)->Arg(0)->Arg(1);
+
+// BM_GetFromDefaults: read a key held only by set_default(), looking in data and then
+// defaults (Arg 0) or once in the merged view of a layered store (Arg 1)
+static void BM_GetFromDefaults(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save    = config::SaveStrategy::Manual;
+    opts.layered = state.range(0) != 0;
+    config::ConfigStore store("bm_get_defaults.json", opts);
+    store.set("server/port", 42);
+    store.set_default("server/timeout", 30);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(store.get<int>("server/timeout"));
+    }
+    std::filesystem::remove("bm_get_defaults.json");
+}
+BENCHMARK(BM_GetFromDefaults)->Arg(0)->Arg(1);
+
+// BM_SetLayeredLarge: write one leaf of a ~50k-leaf config, flat (Arg 0) or layered (Arg 1);
+// a layered write recomputes only the written key from the layers
+static void BM_SetLayeredLarge(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save    = config::SaveStrategy::Manual;
+    opts.layered = state.range(0) != 0;
+    config::ConfigStore store("bm_set_layered.json", opts);
+    nlohmann::json tree;
+    for (int a = 0; a < 50; ++a)
+        for (int b = 0; b < 1000; ++b)
+            tree["section" + std::to_string(a)]["entry" + std::to_string(b)] = b;
+    store.merge(tree);
+    int i = 0;
+    for (auto _ : state)
+    {
+        store.set("section42/entry777", i++);
+    }
+    std::filesystem::remove("bm_set_layered.json");
+}
+BENCHMARK(BM_SetLayeredLarge)->Arg(0)->Arg(1);
+
+// BM_SetAutoSaveLarge: Auto-save one leaf of a ~10k-leaf config, rewriting the file (Arg 0)
+// or appending a journal record (Arg 1)
+static void BM_SetAutoSaveLarge(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save    = config::SaveStrategy::Auto;
+    opts.journal = state.range(0) != 0;
+    {
+        config::ConfigStore store("bm_set_journal.json", opts);
+        nlohmann::json tree;
+        for (int a = 0; a < 10; ++a)
+            for (int b = 0; b < 1000; ++b)
+                tree["section" + std::to_string(a)]["entry" + std::to_string(b)] = b;
+        store.merge(tree);
+        int i = 0;
+        for (auto _ : state)
+        {
+            store.set("section4/entry777", i++);
+        }
+    }
+    std::filesystem::remove("bm_set_journal.json");
+    std::filesystem::remove("bm_set_journal.json.journal");
+}
+BENCHMARK(BM_SetAutoSaveLarge)->Arg(0)->Arg(1);
+
 // BM_Set: write an int key (Manual save = pure memory)
 static void BM_Set(benchmark::State &state)
 {
@@ -42,6 +431,273 @@ static void BM_SetAutoSave(benchmark::State &state)
 }
 BENCHMARK(BM_SetAutoSave);
 
+// BM_SetDebounced: same write with Debounced save; the file is written by the flusher
+// thread once writes pause, so the caller only marks the store dirty
+static void BM_SetDebounced(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save = config::SaveStrategy::Debounced;
+    {
+        config::ConfigStore store("bm_debounced.json", opts);
+        int i = 0;
+        for (auto _ : state)
+        {
+            store.set("key", i++);
+        }
+    }
+    std::filesystem::remove("bm_debounced.json");
+}
+BENCHMARK(BM_SetDebounced);
+
+// BM_SetJsonTree: stores a fresh 10k-element tree each iteration, copied (Arg 0) or moved
+// (Arg 1) into the store; both arms pay for building the tree, only Arg 0 copies it again
+static void BM_SetJsonTree(benchmark::State &state)
+{
+    config::ConfigStore store("bm_set_json_tree.json", config::Path::Relative, config::SaveStrategy::Manual);
+    nlohmann::json base = nlohmann::json::array();
+    for (int i = 0; i < 10000; ++i)
+        base.push_back({{"id", i}, {"name", "item" + std::to_string(i)}});
+    const bool move = state.range(0) != 0;
+    for (auto _ : state)
+    {
+        nlohmann::json tree = base;
+        if (move)
+            store.set_json("tree", std::move(tree));
+        else
+            store.set_json("tree", tree);
+    }
+    std::filesystem::remove("bm_set_json_tree.json");
+}
+BENCHMARK(BM_SetJsonTree)->Arg(0)->Arg(1);
+
+// BM_CounterGetSet / BM_CounterUpdate: incrementing a counter with get() then set() takes two
+// locks and parses the key twice; update() does the read-modify-write under one lock
+static void BM_CounterGetSet(benchmark::State &state)
+{
+    config::ConfigStore store("bm_counter.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("stats/hits", 0);
+    for (auto _ : state)
+        store.set("stats/hits", store.get<int>("stats/hits") + 1);
+    std::filesystem::remove("bm_counter.json");
+}
+BENCHMARK(BM_CounterGetSet);
+
+static void BM_CounterUpdate(benchmark::State &state)
+{
+    config::ConfigStore store("bm_counter.json", config::Path::Relative, config::SaveStrategy::Manual);
+    store.set("stats/hits", 0);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(store.update<int>("stats/hits", [](int &n) { ++n; }));
+    std::filesystem::remove("bm_counter.json");
+}
+BENCHMARK(BM_CounterUpdate);
+
+// BM_SaveUnchanged / BM_SetEqualAutoSave: a periodic save() of an unchanged store and an
+// idempotent Auto-saved set() both return without serializing or touching the file
+static void BM_SaveUnchanged(benchmark::State &state)
+{
+    config::ConfigStore store("bm_save_unchanged.json", config::Path::Relative, config::SaveStrategy::Manual);
+    for (int i = 0; i < 1000; ++i)
+        store.set("section" + std::to_string(i % 10) + "/key" + std::to_string(i), i);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(store.save());
+    std::filesystem::remove("bm_save_unchanged.json");
+}
+BENCHMARK(BM_SaveUnchanged);
+
+static void BM_SetEqualAutoSave(benchmark::State &state)
+{
+    config::ConfigStore store("bm_set_equal.json", config::Path::Relative, config::SaveStrategy::Auto);
+    store.set("server/port", 8080);
+    for (auto _ : state)
+        store.set("server/port", 8080);
+    std::filesystem::remove("bm_set_equal.json");
+}
+BENCHMARK(BM_SetEqualAutoSave);
+
+// BM_SaveLarge: one change plus save() of a 20k-key store; save() pins the live tree instead of
+// deep-copying it, so with no concurrent writer the tree is never duplicated
+static void BM_SaveLarge(benchmark::State &state)
+{
+    config::ConfigStore store("bm_save_large.json", config::Path::Relative, config::SaveStrategy::Manual);
+    for (int i = 0; i < 20000; ++i)
+        store.set("section" + std::to_string(i % 20) + "/key" + std::to_string(i), "value" + std::to_string(i));
+    int i = 0;
+    for (auto _ : state)
+    {
+        store.set("live/counter", i++);
+        benchmark::DoNotOptimize(store.save(config::JsonFormat::Compact));
+    }
+    std::filesystem::remove("bm_save_large.json");
+}
+BENCHMARK(BM_SaveLarge);
+
+// BM_LoadFormat / BM_SaveFormat: opening and saving the same 20k-key store as text JSON (Arg 0),
+// MessagePack (1), CBOR (2), BSON (3) and UBJSON (4)
+static config::StoreOptions format_options(const benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save        = config::SaveStrategy::Manual;
+    opts.format      = config::JsonFormat::Compact;
+    opts.file_format = static_cast<config::FileFormat>(state.range(0));
+    return opts;
+}
+
+static void fill_format_fixture(config::ConfigStore &store)
+{
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::string key = "section" + std::to_string(i % 20) + "/key" + std::to_string(i);
+        if (i % 2 == 0)
+            store.set(key, i * 7);
+        else
+            store.set(key, "value" + std::to_string(i));
+    }
+}
+
+static void BM_LoadFormat(benchmark::State &state)
+{
+    const std::string file = "bm_format_load_" + std::to_string(state.range(0)) + ".cfg";
+    {
+        config::ConfigStore store(file, format_options(state));
+        fill_format_fixture(store);
+        if (!store.save())
+            throw std::runtime_error("BM_LoadFormat: fixture save failed");
+    }
+    for (auto _ : state)
+    {
+        config::ConfigStore store(file, format_options(state));
+        benchmark::DoNotOptimize(store.contains("section0/key0"));
+    }
+    std::filesystem::remove(file);
+}
+BENCHMARK(BM_LoadFormat)->DenseRange(0, 4);
+
+static void BM_SaveFormat(benchmark::State &state)
+{
+    const std::string file = "bm_format_save_" + std::to_string(state.range(0)) + ".cfg";
+    config::ConfigStore store(file, format_options(state));
+    fill_format_fixture(store);
+    int i = 0;
+    for (auto _ : state)
+    {
+        store.set("live/counter", i++);
+        benchmark::DoNotOptimize(store.save());
+    }
+    std::filesystem::remove(file);
+}
+BENCHMARK(BM_SaveFormat)->DenseRange(0, 4);
+
+// BM_LoadLazySections: opening a 40-section, 40k-key store and reading one key from each of 3 sections,
+// parsing the whole file (Arg 0) or only the sections read (Arg 1, StoreOptions::lazy_sections)
+static void BM_LoadLazySections(benchmark::State &state)
+{
+    config::StoreOptions opts;
+    opts.save          = config::SaveStrategy::Manual;
+    opts.lazy_sections = state.range(0) != 0;
+    {
+        config::ConfigStore store("bm_lazy_sections.json", opts);
+        nlohmann::json doc;
+        for (int i = 0; i < 40000; ++i)
+            doc["section" + std::to_string(i % 40)]["key" + std::to_string(i)] = "value" + std::to_string(i);
+        store.set("", doc);
+        if (!store.save())
+            throw std::runtime_error("BM_LoadLazySections: fixture save failed");
+    }
+    for (auto _ : state)
+    {
+        config::ConfigStore store("bm_lazy_sections.json", opts);
+        benchmark::DoNotOptimize(store.get<std::string>("section0/key0"));
+        benchmark::DoNotOptimize(store.get<std::string>("section1/key1"));
+        benchmark::DoNotOptimize(store.get<std::string>("section2/key2"));
+    }
+    std::filesystem::remove("bm_lazy_sections.json");
+}
+BENCHMARK(BM_LoadLazySections)->Arg(0)->Arg(1);
+
+// BM_SetAutoSaveConcurrent: 8 threads x 10 Auto-saved sets per iteration; writers arriving
+// while a save is running share the next one (group commit) instead of each writing the file
+static void BM_SetAutoSaveConcurrent(benchmark::State &state)
+{
+    config::ConfigStore store("bm_group_commit.json", config::Path::Relative, config::SaveStrategy::Auto);
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+            threads.emplace_back([&store, t] {
+                for (int i = 0; i < 10; ++i)
+                    store.set("t" + std::to_string(t), i);
+            });
+        for (auto &thread : threads)
+            thread.join();
+    }
+    std::filesystem::remove("bm_group_commit.json");
+}
+BENCHMARK(BM_SetAutoSaveConcurrent);
+
+// BM_SaveSync / BM_SaveAsync: caller-side cost of saving after each write; save_async()
+// only queues the request, and requests made during a write collapse into the next one
+static void BM_SaveSync(benchmark::State &state)
+{
+    config::ConfigStore store("bm_save_sync.json", config::Path::Relative, config::SaveStrategy::Manual);
+    int i = 0;
+    for (auto _ : state)
+    {
+        store.set("key", i++);
+        benchmark::DoNotOptimize(store.save());
+    }
+    std::filesystem::remove("bm_save_sync.json");
+}
+BENCHMARK(BM_SaveSync);
+
+static void BM_SaveAsync(benchmark::State &state)
+{
+    {
+        config::ConfigStore store("bm_save_async.json", config::Path::Relative, config::SaveStrategy::Manual);
+        int i = 0;
+        for (auto _ : state)
+        {
+            store.set("key", i++);
+            auto done = store.save_async();
+            benchmark::DoNotOptimize(done);
+        }
+    }
+    std::filesystem::remove("bm_save_async.json");
+}
+BENCHMARK(BM_SaveAsync);
+
+// BM_Set50AutoSave / BM_Transaction50AutoSave: update 50 keys with Auto save, one set()
+// (and one file write) per key vs one transaction() that writes the file once
+static void BM_Set50AutoSave(benchmark::State &state)
+{
+    config::ConfigStore store("bm_set50.json", config::Path::Relative, config::SaveStrategy::Auto);
+    int i = 0;
+    for (auto _ : state)
+    {
+        for (int k = 0; k < 50; ++k)
+            store.set("keys/k" + std::to_string(k), i);
+        ++i;
+    }
+    std::filesystem::remove("bm_set50.json");
+}
+BENCHMARK(BM_Set50AutoSave);
+
+static void BM_Transaction50AutoSave(benchmark::State &state)
+{
+    config::ConfigStore store("bm_txn50.json", config::Path::Relative, config::SaveStrategy::Auto);
+    int i = 0;
+    for (auto _ : state)
+    {
+        store.transaction([i](config::Txn &t) {
+            for (int k = 0; k < 50; ++k)
+                t.set("keys/k" + std::to_string(k), i);
+        });
+        ++i;
+    }
+    std::filesystem::remove("bm_txn50.json");
+}
+BENCHMARK(BM_Transaction50AutoSave);
+
 // BM_Contains: check key existence
 static void BM_Contains(benchmark::State &state)
 {
@@ -42,7 +42,26 @@
 #include <unistd.h>
 #endif
 
+#include <config/detail/atomic_shared_ptr.hpp>
+#include <config/detail/conversion_cache.hpp>
+#include <config/detail/convert.hpp>
+#include <config/detail/cow_json.hpp>
+#include <config/detail/expected.hpp>
+#include <config/detail/file_codec.hpp>
+#include <config/detail/file_io.hpp>
+#include <config/detail/journal.hpp>
+#include <config/detail/json_path.hpp>
+#include <config/detail/json_writer.hpp>
+#include <config/detail/layer_stack.hpp>
+#include <config/detail/lazy_document.hpp>
+#include <config/detail/live_value.hpp>
 #include <config/detail/obfuscation.hpp>
+#include <config/detail/path_index.hpp>
 #include <config/detail/path_resolver.hpp>
+#include <config/detail/scalar_slots.hpp>
+#include <config/detail/static_key.hpp>
+#include <config/detail/string_hash.hpp>
+#include <config/detail/stripe_locks.hpp>
 #include <config/detail/types.hpp>
+#include <config/detail/utf8.hpp>
 #include <config/store.hpp>
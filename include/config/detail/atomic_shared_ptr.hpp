@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace config::detail
+{
+
+/**
+ * @brief Minimal atomic std::shared_ptr cell.
+ *
+ * Uses std::atomic<std::shared_ptr<T>> where the standard library provides it
+ * and falls back to the std::atomic_load / std::atomic_store free functions
+ * otherwise (e.g. libc++), so the store can publish immutable values to
+ * lock-free readers on every supported toolchain.
+ */
+template <typename T> class AtomicSharedPtr
+{
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<T>> ptr_;
+
+  public:
+    AtomicSharedPtr() = default;
+    explicit AtomicSharedPtr(std::shared_ptr<T> p) : ptr_(std::move(p))
+    {
+    }
+
+    std::shared_ptr<T> load() const noexcept
+    {
+        return ptr_.load(std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<T> p) noexcept
+    {
+        ptr_.store(std::move(p), std::memory_order_release);
+    }
+#else
+    std::shared_ptr<T> ptr_;
+
+  public:
+    AtomicSharedPtr() = default;
+    explicit AtomicSharedPtr(std::shared_ptr<T> p) : ptr_(std::move(p))
+    {
+    }
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+    std::shared_ptr<T> load() const noexcept
+    {
+        return std::atomic_load_explicit(&ptr_, std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<T> p) noexcept
+    {
+        std::atomic_store_explicit(&ptr_, std::move(p), std::memory_order_release);
+    }
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+    AtomicSharedPtr(const AtomicSharedPtr &)            = delete;
+    AtomicSharedPtr &operator=(const AtomicSharedPtr &) = delete;
+};
+
+} // namespace config::detail
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+
+namespace config::detail
+{
+
+/**
+ * @brief Memo of typed values converted from the JSON tree.
+ *
+ * Entries are keyed by (canonical key, type) and belong to a single store
+ * generation: the first insert made for a newer generation drops every entry
+ * of the older one, and lookups for any other generation miss.  Safe to use
+ * from concurrent readers.
+ */
+class ConversionCache
+{
+    struct KeyView
+    {
+        std::string_view key;
+        std::type_index type;
+    };
+
+    struct Key
+    {
+        std::string key;
+        std::type_index type;
+    };
+
+    struct Hash
+    {
+        using is_transparent = void;
+        size_t operator()(const KeyView &k) const noexcept
+        {
+            return std::hash<std::string_view>{}(k.key) ^ (k.type.hash_code() * 0x9e3779b97f4a7c15ULL);
+        }
+        size_t operator()(const Key &k) const noexcept
+        {
+            return (*this)(KeyView{k.key, k.type});
+        }
+    };
+
+    struct Equal
+    {
+        using is_transparent = void;
+        static KeyView view(const KeyView &k) noexcept
+        {
+            return k;
+        }
+        static KeyView view(const Key &k) noexcept
+        {
+            return {k.key, k.type};
+        }
+        template <typename A, typename B> bool operator()(const A &a, const B &b) const noexcept
+        {
+            return view(a).key == view(b).key && view(a).type == view(b).type;
+        }
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::uint64_t generation_ = 0;
+    std::unordered_map<Key, std::shared_ptr<const void>, Hash, Equal> entries_;
+
+  public:
+    template <typename T> std::shared_ptr<const T> find(std::string_view key, std::uint64_t generation) const
+    {
+        std::shared_lock lock(mutex_);
+        if (generation != generation_)
+            return nullptr;
+        const auto it = entries_.find(KeyView{key, typeid(T)});
+        if (it == entries_.end())
+            return nullptr;
+        return std::static_pointer_cast<const T>(it->second);
+    }
+
+    template <typename T> void insert(std::string_view key, std::uint64_t generation, std::shared_ptr<const T> value)
+    {
+        std::unique_lock lock(mutex_);
+        if (generation < generation_)
+            return; // converted from an older tree; a newer generation already owns the cache
+        if (generation > generation_)
+        {
+            entries_.clear();
+            generation_ = generation;
+        }
+        entries_.insert_or_assign(Key{std::string(key), typeid(T)}, std::move(value));
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock(mutex_);
+        return entries_.size();
+    }
+};
+
+} // namespace config::detail
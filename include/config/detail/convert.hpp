@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/expected.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Converts a JSON node to T, reporting failure as Error::TypeMismatch.
+ *
+ * Scalars, strings and json itself are screened with nlohmann's type
+ * predicates first, so the common mismatches cost no exception.  Other types
+ * (structs, containers) can only be checked by attempting get<T>().
+ */
+template <typename T> Expected<T> convert(const nlohmann::json &node)
+{
+    if constexpr (std::is_same_v<T, nlohmann::json>)
+    {
+        return node;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        if (!node.is_boolean())
+            return fail(Error::TypeMismatch);
+        return node.get<bool>();
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (node.is_number())
+            return node.get<T>();
+        if (!node.is_boolean())
+            return fail(Error::TypeMismatch);
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        if (!node.is_string())
+            return fail(Error::TypeMismatch);
+        return node.get_ref<const std::string &>();
+    }
+
+    // Booleans read as numbers depend on the exact number type, and other
+    // types have no cheap predicate: let get<T>() decide.
+    try
+    {
+        return node.get<T>();
+    }
+    catch (...)
+    {
+        return fail(Error::TypeMismatch);
+    }
+}
+
+} // namespace config::detail
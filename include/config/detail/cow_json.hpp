@@ -0,0 +1,109 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/atomic_shared_ptr.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Copy-on-write owner of a JSON tree.
+ *
+ * All members except pin_published() must be called with the owning store's
+ * mutex held (shared for reads, exclusive for writes).  mut() clones the tree
+ * before handing out a mutable reference whenever another owner still shares
+ * it, so a pinned tree is never modified underneath its holder.
+ *
+ * commit() reports whether the tree was modified since the previous commit.
+ * When publishing is enabled it also makes the latest tree visible to
+ * lock-free readers through pin_published(); a published tree is shared by
+ * definition, so the first mut() after each commit() copies it.
+ */
+class CowJson
+{
+    using json = nlohmann::json;
+
+    std::shared_ptr<json> live_ = std::make_shared<json>(json::object());
+    AtomicSharedPtr<const json> published_;
+    bool publishing_ = false;
+    bool modified_   = false;
+
+  public:
+    explicit CowJson(bool publishing = false) : publishing_(publishing)
+    {
+        if (publishing_)
+            published_.store(live_);
+    }
+
+    CowJson(const CowJson &)            = delete;
+    CowJson &operator=(const CowJson &) = delete;
+
+    const json &get() const noexcept
+    {
+        return *live_;
+    }
+
+    json &mut()
+    {
+        if (live_.use_count() > 1)
+            live_ = std::make_shared<json>(*live_);
+        modified_ = true;
+        return *live_;
+    }
+
+    // True while a pin() or a published copy still shares the tree, i.e. mut() would copy it.
+    bool shared() const noexcept
+    {
+        return live_.use_count() > 1;
+    }
+
+    // The tree for in-place edits that bypass copy-on-write and commit(); only valid while !shared().
+    json &unshared() noexcept
+    {
+        return *live_;
+    }
+
+    void reset(json value)
+    {
+        live_     = std::make_shared<json>(std::move(value));
+        modified_ = true;
+    }
+
+    // Shares the current tree; callers must treat it as immutable.
+    std::shared_ptr<const json> pin() const noexcept
+    {
+        return live_;
+    }
+
+    void restore(std::shared_ptr<const json> tree)
+    {
+        live_     = std::const_pointer_cast<json>(std::move(tree));
+        modified_ = true;
+    }
+
+    bool commit() noexcept
+    {
+        if (!modified_)
+            return false;
+        if (publishing_)
+            published_.store(live_);
+        modified_ = false;
+        return true;
+    }
+
+    bool publishing() const noexcept
+    {
+        return publishing_;
+    }
+
+    std::shared_ptr<const json> pin_published() const noexcept
+    {
+        return published_.load();
+    }
+};
+
+} // namespace config::detail
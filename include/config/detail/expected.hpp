@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stdexcept>
+#include <utility>
+#include <variant>
+#include <version>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#define CONFIG_HAS_STD_EXPECTED 1
+#else
+#define CONFIG_HAS_STD_EXPECTED 0
+#endif
+
+#include <config/detail/types.hpp>
+
+namespace config
+{
+
+#if CONFIG_HAS_STD_EXPECTED
+
+/**
+ * @brief Result of the store's try_* accessors: a value or an Error.
+ */
+template <typename T> using Expected = std::expected<T, Error>;
+
+namespace detail
+{
+inline std::unexpected<Error> fail(const Error error) noexcept
+{
+    return std::unexpected<Error>(error);
+}
+} // namespace detail
+
+#else
+
+namespace detail
+{
+struct Failure
+{
+    Error error;
+};
+
+inline Failure fail(const Error error) noexcept
+{
+    return {error};
+}
+} // namespace detail
+
+/**
+ * @brief Result of the store's try_* accessors: a value or an Error.
+ *
+ * Stand-in for std::expected<T, Error> on standard libraries without
+ * <expected>.  It offers the observers used with std::expected (has_value,
+ * operator bool, operator*, operator->, value, error, value_or), so code
+ * written against either compiles unchanged.  value() on an error throws
+ * std::logic_error instead of std::bad_expected_access.
+ */
+template <typename T> class Expected
+{
+    std::variant<T, Error> state_;
+
+  public:
+    using value_type = T;
+    using error_type = Error;
+
+    Expected(const T &value) : state_(std::in_place_index<0>, value)
+    {
+    }
+    Expected(T &&value) : state_(std::in_place_index<0>, std::move(value))
+    {
+    }
+    Expected(const detail::Failure failure) noexcept : state_(std::in_place_index<1>, failure.error)
+    {
+    }
+
+    bool has_value() const noexcept
+    {
+        return state_.index() == 0;
+    }
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    T &operator*() & noexcept
+    {
+        return *std::get_if<0>(&state_);
+    }
+    const T &operator*() const & noexcept
+    {
+        return *std::get_if<0>(&state_);
+    }
+    T &&operator*() && noexcept
+    {
+        return std::move(*std::get_if<0>(&state_));
+    }
+    T *operator->() noexcept
+    {
+        return std::get_if<0>(&state_);
+    }
+    const T *operator->() const noexcept
+    {
+        return std::get_if<0>(&state_);
+    }
+
+    T &value() &
+    {
+        if (!has_value())
+            throw std::logic_error("Expected::value() called on an error result");
+        return **this;
+    }
+    const T &value() const &
+    {
+        if (!has_value())
+            throw std::logic_error("Expected::value() called on an error result");
+        return **this;
+    }
+    T &&value() &&
+    {
+        if (!has_value())
+            throw std::logic_error("Expected::value() called on an error result");
+        return std::move(**this);
+    }
+
+    Error error() const noexcept
+    {
+        return *std::get_if<1>(&state_);
+    }
+
+    template <typename U> T value_or(U &&fallback) const &
+    {
+        return has_value() ? **this : static_cast<T>(std::forward<U>(fallback));
+    }
+    template <typename U> T value_or(U &&fallback) &&
+    {
+        return has_value() ? std::move(**this) : static_cast<T>(std::forward<U>(fallback));
+    }
+};
+
+#endif
+
+} // namespace config
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/file_io.hpp>
+#include <config/detail/obfuscation.hpp>
+#include <config/detail/types.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Reads and encodes store files in a FileFormat (StoreOptions::file_format).
+ *
+ * Files are read whole into one buffer and parsed from that pointer range,
+ * text JSON with nlohmann's parser and the binary formats with its from_*
+ * readers.  Saving text JSON is left to JsonWriter, which streams; the binary
+ * encoders need the complete document, so encode() builds it.
+ */
+class FileCodec
+{
+    using json = nlohmann::json;
+
+  public:
+    /**
+     * @brief Parses the file at @p path.
+     * @throws std::runtime_error If the file cannot be read.
+     * @throws nlohmann::json::exception If the file is not a valid document in @p format.
+     */
+    static json read(const std::string &path, const FileFormat format)
+    {
+        return decode(FileIO::read_file(path), format);
+    }
+
+    /**
+     * @brief Parses the document at the start of @p bytes, which is in @p format.
+     *
+     * Text after a complete JSON value is ignored, as stream extraction
+     * (file >> root) ignores it, so files that loaded that way still do.
+     *
+     * @throws nlohmann::json::exception If @p bytes do not start with a valid document.
+     */
+    static json decode(const std::string_view bytes, const FileFormat format)
+    {
+        const char *first = bytes.data();
+        const char *last  = first + bytes.size();
+        switch (format)
+        {
+        case FileFormat::MessagePack:
+            return json::from_msgpack(first, last);
+        case FileFormat::Cbor:
+            return json::from_cbor(first, last);
+        case FileFormat::Bson:
+            return json::from_bson(first, last);
+        case FileFormat::Ubjson:
+            return json::from_ubjson(first, last);
+        case FileFormat::Json:
+            break;
+        }
+        try
+        {
+            return json::parse(first, last);
+        }
+        catch (const json::parse_error &)
+        {
+            // Rare enough to pay for a copy: retry without insisting on the end of input after the value.
+            std::istringstream in{std::string(bytes)};
+            json root;
+            in >> root;
+            return root;
+        }
+    }
+
+    /**
+     * @brief Encodes @p root in a binary @p format.
+     *
+     * String values named in @p encodings are encrypted and the encoding table
+     * is added as the root object's @p meta_key member, as JsonWriter does for
+     * text.  That requires a copy of the tree, which is only made when
+     * @p encodings is non-empty.
+     *
+     * @throws nlohmann::json::exception If @p format cannot represent the document.
+     */
+    static std::vector<std::uint8_t> encode(const json &root,
+                                            const std::unordered_map<std::string, Encoding> &encodings,
+                                            const std::string &meta_key, const FileFormat format)
+    {
+        if (encodings.empty() || !root.is_object())
+            return to_bytes(root, format);
+        json document = root;
+        json meta     = json::object();
+        for (const auto &[key, type] : encodings)
+        {
+            meta[key] = static_cast<int>(type);
+            if (type == Encoding::None)
+                continue;
+            try
+            {
+                const json::json_pointer ptr(key.starts_with('/') ? key : "/" + key);
+                if (document.contains(ptr) && document[ptr].is_string())
+                    document[ptr] = ObfuscationEngine::encrypt(document[ptr].get<std::string>(), type);
+            }
+            catch (const json::exception &)
+            {
+            }
+        }
+        document[meta_key] = std::move(meta);
+        return to_bytes(document, format);
+    }
+
+    static std::vector<std::uint8_t> to_bytes(const json &root, const FileFormat format)
+    {
+        switch (format)
+        {
+        case FileFormat::MessagePack:
+            return json::to_msgpack(root);
+        case FileFormat::Cbor:
+            return json::to_cbor(root);
+        case FileFormat::Bson:
+            return json::to_bson(root);
+        case FileFormat::Ubjson:
+            return json::to_ubjson(root);
+        case FileFormat::Json:
+            break;
+        }
+        const std::string text = root.dump();
+        return {text.begin(), text.end()};
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <config/detail/types.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Whole-file reads, and whole-file and append writes with an optional sync to stable storage.
+ *
+ * Thin wrappers over the platform file API, used instead of std::ofstream
+ * where a save has to reach the disk before it reports success.
+ */
+class FileIO
+{
+#if defined(_WIN32)
+    using Handle = HANDLE;
+
+    static Handle open(const std::string &path, const bool append)
+    {
+        return CreateFileA(path.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                           append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
+
+    static bool valid(const Handle h) noexcept
+    {
+        return h != INVALID_HANDLE_VALUE;
+    }
+
+    static bool write_all(const Handle h, std::string_view data)
+    {
+        while (!data.empty())
+        {
+            DWORD written = 0;
+            const DWORD chunk =
+                data.size() > 0x40000000 ? static_cast<DWORD>(0x40000000) : static_cast<DWORD>(data.size());
+            if (!WriteFile(h, data.data(), chunk, &written, nullptr))
+                return false;
+            data.remove_prefix(written);
+        }
+        return true;
+    }
+
+    static bool sync(const Handle h) noexcept
+    {
+        return FlushFileBuffers(h) != 0;
+    }
+
+    static bool close(const Handle h) noexcept
+    {
+        return CloseHandle(h) != 0;
+    }
+
+    static bool replace(const std::string &from, const std::string &to)
+    {
+        return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+    }
+#else
+    using Handle = int;
+
+    static Handle open(const std::string &path, const bool append)
+    {
+        return ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC), 0644);
+    }
+
+    static bool valid(const Handle h) noexcept
+    {
+        return h >= 0;
+    }
+
+    static bool write_all(const Handle h, std::string_view data)
+    {
+        while (!data.empty())
+        {
+            const ssize_t written = ::write(h, data.data(), data.size());
+            if (written < 0)
+                return false;
+            data.remove_prefix(static_cast<size_t>(written));
+        }
+        return true;
+    }
+
+    static bool sync(const Handle h) noexcept
+    {
+#if defined(__APPLE__)
+        return ::fsync(h) == 0;
+#else
+        return ::fdatasync(h) == 0;
+#endif
+    }
+
+    static bool close(const Handle h) noexcept
+    {
+        return ::close(h) == 0;
+    }
+
+    // rename() and then sync the directory so the new entry itself is durable.
+    static bool replace(const std::string &from, const std::string &to)
+    {
+        if (::rename(from.c_str(), to.c_str()) != 0)
+            return false;
+        const size_t slash    = to.find_last_of('/');
+        const std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : to.substr(0, slash));
+        const int fd          = ::open(dir.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0)
+        {
+            ::fsync(fd);
+            ::close(fd);
+        }
+        return true;
+    }
+#endif
+
+    static bool write_to(const std::string &path, const std::string_view data, const bool append, const bool durable)
+    {
+        const Handle h = open(path, append);
+        if (!valid(h))
+            return false;
+        bool ok = write_all(h, data);
+        if (ok && durable)
+            ok = sync(h);
+        return close(h) && ok;
+    }
+
+  public:
+    /**
+     * @brief Replaces the contents of @p path with the text @p produce writes.
+     *
+     * @p produce is called as produce(sink), where sink(std::string_view) writes
+     * one chunk straight to the file and returns false on an I/O error;
+     * produce returns false, or throws, to abandon the write.  The file is
+     * opened at the first chunk, so an attempt abandoned before then leaves it
+     * untouched.  With Durability::Atomic the chunks go to a temporary file
+     * that only replaces @p path once complete; otherwise @p path is written
+     * in place, like a std::ofstream, so @p produce must reject its input
+     * before the first chunk: an attempt abandoned midway leaves @p path
+     * truncated.
+     *
+     * @return true if everything was written (and synced or renamed into place, as requested).
+     */
+    template <typename Produce>
+    static bool write_stream(const std::string &path, const Durability durability, Produce &&produce)
+    {
+        const bool atomic        = durability == Durability::Atomic;
+        const std::string target = atomic ? path + ".tmp" : path;
+        std::optional<Handle> handle;
+        const auto sink = [&](const std::string_view chunk) {
+            if (!handle)
+                handle = open(target, false);
+            return valid(*handle) && write_all(*handle, chunk);
+        };
+        bool ok = false;
+        try
+        {
+            ok = produce(sink);
+        }
+        catch (...)
+        {
+            ok = false;
+        }
+        if (ok && !handle)
+            ok = sink({});
+        if (handle && valid(*handle))
+        {
+            if (ok && durability != Durability::None)
+                ok = sync(*handle);
+            ok = close(*handle) && ok;
+        }
+        if (!atomic || !handle)
+            return ok;
+        if (ok && replace(target, path))
+            return true;
+        std::error_code ec;
+        std::filesystem::remove(target, ec);
+        return false;
+    }
+
+    /**
+     * @brief Replaces the contents of @p path with @p data.
+     * @return true if the data was written (and synced or renamed into place, as requested).
+     */
+    static bool write_file(const std::string &path, const std::string_view data, const Durability durability)
+    {
+        return write_stream(path, durability, [data](const auto &sink) { return sink(data); });
+    }
+
+    /**
+     * @brief Returns the contents of @p path.
+     *
+     * The file is read with one request of its full size, which the standard
+     * library passes straight to the OS instead of staging it in the stream
+     * buffer, so the bytes are copied once from the page cache and can be
+     * parsed in place.
+     *
+     * @throws std::runtime_error If the file cannot be opened or read.
+     */
+    static std::string read_file(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(path, ec);
+        if (!file || ec)
+            throw std::runtime_error("cannot read " + path);
+        std::string bytes(static_cast<size_t>(size), '\0');
+        const auto got = file.rdbuf()->sgetn(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        bytes.resize(static_cast<size_t>(got));
+        return bytes;
+    }
+
+    /**
+     * @brief Appends @p data to @p path, creating it if needed.
+     * @return true if the data was written (and synced when @p durable).
+     */
+    static bool append_file(const std::string &path, const std::string_view data, const bool durable)
+    {
+        return write_to(path, data, true, durable);
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/file_io.hpp>
+#include <config/detail/layer_stack.hpp>
+#include <config/detail/obfuscation.hpp>
+#include <config/detail/types.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Append-only change log kept next to a store's file (StoreOptions::journal).
+ *
+ * Each line of "<file>.journal" is one JSON array of operations that were
+ * committed together, in the style of a JSON Patch document:
+ *
+ *   {"op":"add","path":"/a/b","value":...}   sets a value, creating parents (with "enc" if obfuscated)
+ *   {"op":"remove","path":"/a/b"}             removes a value
+ *
+ * An add or remove that also updates the obfuscation map carries the key
+ * exactly as the caller wrote it in "key" ("/a/b" and "a/b" are distinct map
+ * entries), and replay records the encoding under that key; one without
+ * "key" leaves the map alone.
+ *   {"op":"replace","path":"","value":{...}}  replaces the whole document
+ *   {"op":"merge","value":{...}}               deep-merges an object into the document (obfuscated keys encoded)
+ *
+ * A full save first moves the journal aside to "<file>.journal.old" and
+ * deletes it once the base file is written, so a crash at any point leaves
+ * base + old + journal describing the latest committed state.  A torn last
+ * line, one without its newline, is dropped on replay.
+ *
+ * Not synchronized beyond size(); the store appends with its mutex held
+ * exclusively and rotates with it held shared and its save mutex held.
+ */
+class Journal
+{
+    using json = nlohmann::json;
+
+    std::string path_;
+    std::string old_path_;
+    std::atomic<size_t> size_{0}; // bytes in both files, as far as this process knows
+
+    // Encodes (or decodes) the string values of a merge overlay at the keys that have an encoding.
+    static void transcode(json &overlay, const std::unordered_map<std::string, Encoding> &obfuscation,
+                          const bool encode)
+    {
+        for (const auto &[key, codec] : obfuscation)
+        {
+            if (codec == Encoding::None)
+                continue;
+            try
+            {
+                const json::json_pointer ptr(key.starts_with('/') ? key : "/" + key);
+                if (!overlay.contains(ptr))
+                    continue;
+                json &value = overlay[ptr];
+                if (value.is_string())
+                {
+                    value = encode ? ObfuscationEngine::encrypt(value.get<std::string>(), codec)
+                                   : ObfuscationEngine::decrypt(value.get<std::string>(), codec);
+                }
+            }
+            catch (const json::exception &)
+            {
+            }
+        }
+    }
+
+    static void apply(json &root, const json &op, std::unordered_map<std::string, Encoding> &obfuscation)
+    {
+        const std::string &name = op.at("op").get_ref<const std::string &>();
+        if (name == "merge")
+        {
+            json overlay = op.at("value");
+            transcode(overlay, obfuscation, false);
+            deep_merge(root, std::move(overlay));
+            return;
+        }
+        const std::string &path = op.at("path").get_ref<const std::string &>();
+        if (name == "replace" && path.empty())
+        {
+            root = op.at("value");
+            obfuscation.clear();
+            return;
+        }
+        const json::json_pointer ptr(path);
+        if (name == "add")
+        {
+            json value           = op.at("value");
+            const Encoding codec = static_cast<Encoding>(op.value("enc", 0));
+            if (codec != Encoding::None && value.is_string())
+                value = ObfuscationEngine::decrypt(value.get<std::string>(), codec);
+            if (const auto key = op.find("key"); key != op.end())
+            {
+                if (codec != Encoding::None)
+                    obfuscation[key->get<std::string>()] = codec;
+                else
+                    obfuscation.erase(key->get<std::string>());
+            }
+            root[ptr] = std::move(value);
+        }
+        else if (name == "remove")
+        {
+            if (root.contains(ptr))
+                root.at(ptr.parent_pointer()).erase(ptr.back());
+            if (const auto key = op.find("key"); key != op.end())
+                obfuscation.erase(key->get<std::string>());
+        }
+    }
+
+    // Replays one journal file and cuts off a torn last line, so the next append starts on a
+    // fresh line.  Returns the size of the intact part.
+    static size_t replay_file(const std::string &path, json &root,
+                              std::unordered_map<std::string, Encoding> &obfuscation)
+    {
+        size_t intact = 0;
+        {
+            std::ifstream in(path, std::ios::binary);
+            if (!in)
+                return 0;
+            std::string line;
+            while (std::getline(in, line) && !in.eof())
+            {
+                json ops;
+                try
+                {
+                    ops = json::parse(line);
+                }
+                catch (const json::exception &)
+                {
+                    break;
+                }
+                for (const auto &op : ops)
+                {
+                    try
+                    {
+                        apply(root, op, obfuscation);
+                    }
+                    catch (const json::exception &)
+                    {
+                    }
+                }
+                intact += line.size() + 1;
+            }
+        }
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(path, ec);
+        if (!ec && size != intact)
+            std::filesystem::resize_file(path, intact, ec);
+        return intact;
+    }
+
+  public:
+    // Places the journal next to file_path.  Called once, before the first replay.
+    void attach(const std::string &file_path)
+    {
+        path_     = file_path + ".journal";
+        old_path_ = file_path + ".journal.old";
+    }
+
+    // key: the caller's key when the write also records its encoding in the obfuscation map.
+    static json add(const std::string &path, json value, const Encoding codec,
+                    const std::optional<std::string_view> key = std::nullopt)
+    {
+        json op = {{"op", "add"}, {"path", path}};
+        if (key)
+            op["key"] = *key;
+        if (codec != Encoding::None)
+        {
+            if (value.is_string())
+                value = ObfuscationEngine::encrypt(value.get<std::string>(), codec);
+            op["enc"] = static_cast<int>(codec);
+        }
+        op["value"] = std::move(value);
+        return op;
+    }
+
+    static json remove(const std::string &path, const std::string_view key)
+    {
+        return {{"op", "remove"}, {"path", path}, {"key", key}};
+    }
+
+    static json replace(json root)
+    {
+        return {{"op", "replace"}, {"path", ""}, {"value", std::move(root)}};
+    }
+
+    // Merge of overlay into a document whose obfuscated keys are listed in obfuscation.
+    static json merge(json overlay, const std::unordered_map<std::string, Encoding> &obfuscation)
+    {
+        transcode(overlay, obfuscation, true);
+        return {{"op", "merge"}, {"value", std::move(overlay)}};
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    // Appends one line holding ops, synced to disk when durable; returns false on an I/O error.
+    bool append(const json &ops, const bool durable)
+    {
+        const std::string line = ops.dump() + '\n';
+        if (!FileIO::append_file(path_, line, durable))
+            return false;
+        size_ += line.size();
+        return true;
+    }
+
+    // Applies the old journal and then the live one to root, which holds the decoded base file.
+    void replay(json &root, std::unordered_map<std::string, Encoding> &obfuscation)
+    {
+        size_ = replay_file(old_path_, root, obfuscation) + replay_file(path_, root, obfuscation);
+    }
+
+    // Moves the live journal aside before a full save snapshots the store.  An old journal left
+    // by an earlier failed save keeps its records and gets the live ones appended.
+    void rotate()
+    {
+        std::error_code ec;
+        if (!std::filesystem::exists(path_, ec))
+            return;
+        if (!std::filesystem::exists(old_path_, ec))
+        {
+            std::filesystem::rename(path_, old_path_, ec);
+            return;
+        }
+        {
+            std::ifstream in(path_, std::ios::binary);
+            std::ofstream out(old_path_, std::ios::app | std::ios::binary);
+            out << in.rdbuf();
+            if (!out)
+                return;
+        }
+        std::filesystem::remove(path_, ec);
+    }
+
+    // Drops the rotated journal once the base file holds everything in it.
+    void discard_rotated()
+    {
+        std::error_code ec;
+        std::filesystem::remove(old_path_, ec);
+        size_ = std::filesystem::exists(path_, ec) ? static_cast<size_t>(std::filesystem::file_size(path_, ec)) : 0;
+    }
+};
+
+} // namespace config::detail
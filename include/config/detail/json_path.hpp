@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Allocation-free JSON Pointer navigation over string_view keys.
+ *
+ * Keys use the store's key syntax: a JSON Pointer with an optional leading
+ * slash ("server/port", "/server/port", "a~1b").  Unlike
+ * nlohmann::json::json_pointer, no token vector is built; each segment is
+ * matched in place and only a segment containing an escape is copied.
+ */
+namespace json_path
+{
+
+using json = nlohmann::json;
+
+template <typename Object> const json *find_member(const Object &object, std::string_view name)
+{
+    if constexpr (requires { object.find(name); })
+    {
+        const auto it = object.find(name);
+        return it == object.end() ? nullptr : &it->second;
+    }
+    else
+    {
+        const auto it = object.find(std::string(name));
+        return it == object.end() ? nullptr : &it->second;
+    }
+}
+
+// Decodes ~0 / ~1 escapes; returns false on any other use of '~'.
+inline bool unescape(std::string_view segment, std::string &out)
+{
+    out.clear();
+    out.reserve(segment.size());
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        if (segment[i] != '~')
+        {
+            out += segment[i];
+            continue;
+        }
+        if (i + 1 == segment.size() || (segment[i + 1] != '0' && segment[i + 1] != '1'))
+            return false;
+        out += segment[++i] == '0' ? '~' : '/';
+    }
+    return true;
+}
+
+// Parses an RFC 6901 array index: digits only, no leading zeros.
+constexpr bool parse_index(std::string_view segment, size_t &index) noexcept
+{
+    if (segment.empty() || (segment.size() > 1 && segment.front() == '0'))
+        return false;
+    index = 0;
+    for (const char c : segment)
+    {
+        if (c < '0' || c > '9')
+            return false;
+        const size_t digit = static_cast<size_t>(c - '0');
+        if (index > (static_cast<size_t>(-1) - digit) / 10)
+            return false;
+        index = index * 10 + digit;
+    }
+    return true;
+}
+
+// Appends name to a pointer path, escaping '~' and '/' as ~0 and ~1.
+inline void append_escaped(std::string &path, std::string_view name)
+{
+    for (const char c : name)
+    {
+        if (c == '~')
+            path += "~0";
+        else if (c == '/')
+            path += "~1";
+        else
+            path += c;
+    }
+}
+
+/**
+ * @brief Returns the child of @p node named by one escaped pointer segment.
+ * @return The child, or nullptr if it does not exist or @p node is a scalar.
+ */
+inline const json *child(const json &node, std::string_view segment)
+{
+    if (node.is_object())
+    {
+        const auto &object = node.get_ref<const json::object_t &>();
+        if (segment.find('~') == std::string_view::npos)
+            return find_member(object, segment);
+        std::string name;
+        return unescape(segment, name) ? find_member(object, name) : nullptr;
+    }
+    if (node.is_array())
+    {
+        size_t index = 0;
+        if (!parse_index(segment, index) || index >= node.size())
+            return nullptr;
+        return &node[index];
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Finds the node at @p key in one descent.
+ *
+ * An empty key names @p root itself; "/" names the member with an empty name,
+ * as in JSON Pointer.
+ *
+ * @return The node, or nullptr if the path does not exist or is malformed.
+ */
+inline const json *find_node(const json &root, std::string_view key)
+{
+    if (key.empty())
+        return &root;
+    if (key.front() == '/')
+        key.remove_prefix(1);
+    const json *node = &root;
+    while (node)
+    {
+        const size_t slash = key.find('/');
+        if (slash == std::string_view::npos)
+            return child(*node, key);
+        node = child(*node, key.substr(0, slash));
+        key.remove_prefix(slash + 1);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Mutable counterpart of find_node(), for writers that must not insert on the way down.
+ *
+ * Only find() lookups are made, never operator[], so concurrent readers and
+ * writers of other subtrees may walk the same ancestors.
+ */
+inline json *find_node(json &root, const std::string_view key)
+{
+    // root is not const, so handing back a mutable pointer to a node inside it is well-defined.
+    return const_cast<json *>(find_node(std::as_const(root), key));
+}
+
+// True when one key names the other or a node below it, so a write at either may change the other.
+inline bool overlaps(std::string_view a, std::string_view b) noexcept
+{
+    if (a.starts_with('/'))
+        a.remove_prefix(1);
+    if (b.starts_with('/'))
+        b.remove_prefix(1);
+    if (a.size() > b.size())
+        std::swap(a, b);
+    return b.starts_with(a) && (a.empty() || b.size() == a.size() || b[a.size()] == '/');
+}
+
+// True when a write at key may move array elements: key appends through "-", or one of its ancestors in root
+// is an array, where a write can add, drop, or shift the indices other keys name.
+inline bool through_array(const json &root, std::string_view key)
+{
+    if (key.starts_with('/'))
+        key.remove_prefix(1);
+    const json *node = &root;
+    while (true)
+    {
+        if (node && node->is_array())
+            return true;
+        const size_t slash = key.find('/');
+        const std::string_view segment = key.substr(0, slash);
+        if (segment == "-")
+            return true;
+        if (slash == std::string_view::npos)
+            return false;
+        node = node ? child(*node, segment) : nullptr;
+        key.remove_prefix(slash + 1);
+    }
+}
+
+/**
+ * @brief One pre-split key segment: its unescaped member name, and the array
+ *        index it denotes (npos if it is not a valid index).
+ */
+struct Segment
+{
+    std::string_view name;
+    size_t index;
+};
+
+/**
+ * @brief A key split into segments ahead of time (see config::key).
+ */
+struct SplitKey
+{
+    std::string_view text; ///< The key as written, for the path index and diagnostics.
+    std::span<const Segment> segments;
+};
+
+/**
+ * @brief Finds the node at a pre-split key without scanning or unescaping.
+ * @return The node, or nullptr if the path does not exist.
+ */
+inline const json *find_node(const json &root, const SplitKey &key)
+{
+    const json *node = &root;
+    for (const Segment &segment : key.segments)
+    {
+        if (node->is_object())
+            node = find_member(node->get_ref<const json::object_t &>(), segment.name);
+        else if (node->is_array() && segment.index < node->size())
+            node = &(*node)[segment.index];
+        else
+            return nullptr;
+        if (!node)
+            return nullptr;
+    }
+    return node;
+}
+
+} // namespace json_path
+} // namespace config::detail
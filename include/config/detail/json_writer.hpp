@@ -0,0 +1,428 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/json_path.hpp>
+#include <config/detail/lazy_document.hpp>
+#include <config/detail/obfuscation.hpp>
+#include <config/detail/types.hpp>
+#include <config/detail/utf8.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Serializes a JSON tree as text through a fixed-size buffer.
+ *
+ * Writes the same layout as nlohmann's dump() (dump(4) for JsonFormat::Pretty)
+ * without building the document in memory: text is staged in a 64 KiB buffer
+ * that is handed to the sink, a callable bool(std::string_view), whenever it
+ * fills.  String values whose key has an Encoding are encrypted as they are
+ * written, and the encoding table is emitted as the root's @p meta_key member,
+ * so the tree itself is never copied or modified.  Sections of a LazyDocument
+ * that were never parsed are copied into the root object as they are.
+ *
+ * Floating-point numbers use the shortest representation that round-trips,
+ * which may differ in form (not in value) from nlohmann's.  Strings that are
+ * not valid UTF-8 throw std::runtime_error, as dump() does; write() checks
+ * the whole tree for them before the first byte reaches the sink, so a file
+ * written in place is never abandoned halfway.
+ */
+template <typename Sink> class JsonWriter
+{
+    using json = nlohmann::json;
+
+    static constexpr size_t buffer_size = size_t{64} * 1024;
+    static constexpr size_t indent_step = 4;
+
+    const Sink &sink_;
+    const bool pretty_;
+    std::unique_ptr<char[]> buffer_;
+    size_t used_ = 0;
+    bool ok_     = true;
+    // Encodings by canonical key (no leading '/'); path_ is only maintained when there are any.
+    std::unordered_map<std::string, Encoding> encodings_;
+    std::string path_;
+
+    void flush()
+    {
+        if (used_ != 0 && ok_)
+            ok_ = sink_(std::string_view(buffer_.get(), used_));
+        used_ = 0;
+    }
+
+    void put(const std::string_view text)
+    {
+        if (!ok_)
+            return;
+        if (used_ + text.size() > buffer_size)
+        {
+            flush();
+            if (text.size() >= buffer_size)
+            {
+                ok_ = ok_ && sink_(text);
+                return;
+            }
+        }
+        std::memcpy(buffer_.get() + used_, text.data(), text.size());
+        used_ += text.size();
+    }
+
+    void put(const char c)
+    {
+        if (used_ == buffer_size)
+            flush();
+        buffer_[used_++] = c;
+    }
+
+    void newline(size_t indent)
+    {
+        static constexpr std::string_view spaces = "                                                                ";
+        put('\n');
+        for (; indent > spaces.size(); indent -= spaces.size())
+            put(spaces);
+        put(spaces.substr(0, indent));
+    }
+
+    [[noreturn]] static void invalid_utf8(const size_t i)
+    {
+        throw std::runtime_error("JsonWriter: invalid UTF-8 byte at index " + std::to_string(i));
+    }
+
+    static void check_text(const std::string_view text)
+    {
+        for (size_t i = 0; i < text.size();)
+        {
+            if (static_cast<unsigned char>(text[i]) < 0x80)
+            {
+                ++i;
+                continue;
+            }
+            const size_t length = utf8_sequence_length(text, i);
+            if (length == 0)
+                invalid_utf8(i);
+            i += length;
+        }
+    }
+
+    // Throws as string() would for any name or unencrypted string value in node.
+    void check(const json &node)
+    {
+        if (node.is_object())
+        {
+            for (auto it = node.begin(); it != node.end(); ++it)
+            {
+                check_text(it.key());
+                const size_t length = enter(it.key());
+                check(it.value());
+                path_.resize(length);
+            }
+        }
+        else if (node.is_array())
+        {
+            for (size_t i = 0; i < node.size(); ++i)
+            {
+                const size_t length = encodings_.empty() ? path_.size() : enter(std::to_string(i));
+                check(node[i]);
+                path_.resize(length);
+            }
+        }
+        else if (node.is_string() && (encodings_.empty() || !encodings_.contains(path_)))
+        {
+            check_text(node.get_ref<const std::string &>());
+        }
+    }
+
+    void string(const std::string_view text)
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+        put('"');
+        size_t run = 0; // start of the pending stretch that needs no escaping
+        for (size_t i = 0; i < text.size();)
+        {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x80)
+            {
+                const size_t length = utf8_sequence_length(text, i);
+                if (length == 0)
+                    invalid_utf8(i);
+                i += length;
+                continue;
+            }
+            if (c >= 0x20 && c != '"' && c != '\\')
+            {
+                ++i;
+                continue;
+            }
+            put(text.substr(run, i - run));
+            switch (c)
+            {
+            case '"':
+                put("\\\"");
+                break;
+            case '\\':
+                put("\\\\");
+                break;
+            case '\b':
+                put("\\b");
+                break;
+            case '\f':
+                put("\\f");
+                break;
+            case '\n':
+                put("\\n");
+                break;
+            case '\r':
+                put("\\r");
+                break;
+            case '\t':
+                put("\\t");
+                break;
+            default:
+                put("\\u00");
+                put(hex[c >> 4]);
+                put(hex[c & 0xF]);
+                break;
+            }
+            run = ++i;
+        }
+        put(text.substr(run));
+        put('"');
+    }
+
+    template <typename Number> void integer(const Number value)
+    {
+        char digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof digits, value);
+        put(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    void floating(const double value)
+    {
+        if (!std::isfinite(value))
+        {
+            put("null");
+            return;
+        }
+        char digits[32];
+        const auto result = std::to_chars(digits, digits + sizeof digits, value);
+        const std::string_view text(digits, static_cast<size_t>(result.ptr - digits));
+        put(text);
+        if (text.find_first_of(".e") == std::string_view::npos)
+            put(".0");
+    }
+
+    // Enters member name (or element index) of the current node for encoding lookups.
+    size_t enter(const std::string_view name)
+    {
+        const size_t length = path_.size();
+        if (!encodings_.empty())
+        {
+            if (length != 0)
+                path_ += '/';
+            json_path::append_escaped(path_, name);
+        }
+        return length;
+    }
+
+    // Writes the separator, indentation and name that precede a member's value.
+    void member_name(const std::string_view name, const size_t indent, bool &first)
+    {
+        if (!first)
+            put(',');
+        first = false;
+        if (pretty_)
+            newline(indent);
+        string(name);
+        put(pretty_ ? std::string_view(": ") : std::string_view(":"));
+    }
+
+    void member(const std::string_view name, const json &node, const size_t indent, bool &first)
+    {
+        member_name(name, indent, first);
+        const size_t length = enter(name);
+        value(node, indent);
+        path_.resize(length);
+    }
+
+    // A root member that is not in the tree: the meta table, or a pending section copied as text.
+    struct Extra
+    {
+        std::string_view name;
+        const json *node = nullptr;
+        std::string_view text;
+    };
+
+    void extra(const Extra &member_extra, const size_t indent, bool &first)
+    {
+        if (member_extra.node)
+        {
+            member(member_extra.name, *member_extra.node, indent, first);
+            return;
+        }
+        member_name(member_extra.name, indent, first);
+        put(member_extra.text);
+    }
+
+    // extras, sorted by name, take their sorted places among node's members, replacing any of the same name.
+    void object(const json &node, const size_t indent, const std::span<const Extra> extras = {})
+    {
+        if (node.empty() && extras.empty())
+        {
+            put("{}");
+            return;
+        }
+        put('{');
+        bool first = true;
+        auto next  = extras.begin();
+        for (auto it = node.begin(); it != node.end(); ++it)
+        {
+            const std::string_view name = it.key();
+            bool replaced               = false;
+            for (; next != extras.end() && name >= next->name; ++next)
+            {
+                replaced = replaced || name == next->name;
+                extra(*next, indent + indent_step, first);
+            }
+            if (!replaced)
+                member(name, it.value(), indent + indent_step, first);
+        }
+        for (; next != extras.end(); ++next)
+            extra(*next, indent + indent_step, first);
+        if (pretty_)
+            newline(indent);
+        put('}');
+    }
+
+    void array(const json &node, const size_t indent)
+    {
+        if (node.empty())
+        {
+            put("[]");
+            return;
+        }
+        put('[');
+        for (size_t i = 0; i < node.size(); ++i)
+        {
+            if (i != 0)
+                put(',');
+            if (pretty_)
+                newline(indent + indent_step);
+            const size_t length = encodings_.empty() ? path_.size() : enter(std::to_string(i));
+            value(node[i], indent + indent_step);
+            path_.resize(length);
+        }
+        if (pretty_)
+            newline(indent);
+        put(']');
+    }
+
+    void value(const json &node, const size_t indent)
+    {
+        switch (node.type())
+        {
+        case json::value_t::object:
+            object(node, indent);
+            break;
+        case json::value_t::array:
+            array(node, indent);
+            break;
+        case json::value_t::string: {
+            const std::string &text = node.get_ref<const std::string &>();
+            if (!encodings_.empty())
+            {
+                const auto it = encodings_.find(path_);
+                if (it != encodings_.end())
+                {
+                    string(ObfuscationEngine::encrypt(text, it->second));
+                    break;
+                }
+            }
+            string(text);
+            break;
+        }
+        case json::value_t::boolean:
+            put(node.get<bool>() ? std::string_view("true") : std::string_view("false"));
+            break;
+        case json::value_t::number_integer:
+            integer(node.get<std::int64_t>());
+            break;
+        case json::value_t::number_unsigned:
+            integer(node.get<std::uint64_t>());
+            break;
+        case json::value_t::number_float:
+            floating(node.get<double>());
+            break;
+        case json::value_t::null:
+            put("null");
+            break;
+        default:
+            put(node.dump());
+            break;
+        }
+    }
+
+  public:
+    JsonWriter(const Sink &sink, const JsonFormat format)
+        : sink_(sink), pretty_(format == JsonFormat::Pretty),
+          buffer_(std::make_unique_for_overwrite<char[]>(buffer_size))
+    {
+    }
+
+    /**
+     * @brief Writes @p root, encrypting the string values named in @p encodings.
+     *
+     * A non-empty @p encodings table is also written, as the root object's
+     * @p meta_key member, and so is every section in @p unparsed.
+     *
+     * @return false if the sink reported an error.
+     * @throws std::runtime_error If a string is not valid UTF-8; nothing has been written then.
+     */
+    bool write(const json &root, const std::unordered_map<std::string, Encoding> &encodings,
+               const std::string_view meta_key, const LazyDocument::Sections *unparsed = nullptr)
+    {
+        json meta;
+        for (const auto &[key, type] : encodings)
+        {
+            meta[key] = static_cast<int>(type);
+            if (type != Encoding::None)
+                encodings_.emplace(key.starts_with('/') ? key.substr(1) : key, type);
+        }
+        std::vector<Extra> extras;
+        if (unparsed)
+        {
+            extras.reserve(unparsed->size() + 1);
+            for (const auto &[name, text] : *unparsed)
+                extras.push_back({name, nullptr, text});
+        }
+        if (!encodings.empty())
+        {
+            const auto at = std::lower_bound(extras.begin(), extras.end(), meta_key,
+                                             [](const Extra &e, const std::string_view name) { return e.name < name; });
+            extras.insert(at, {meta_key, &meta, {}});
+        }
+        check(root);
+        if (root.is_object())
+            object(root, 0, extras);
+        else
+            value(root, 0);
+        flush();
+        return ok_;
+    }
+};
+
+} // namespace config::detail
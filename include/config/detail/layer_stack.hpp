@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/json_path.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Recursively merges @p overlay into @p base.
+ *
+ * Objects are merged member by member; any other overlay value (scalar,
+ * array, or an object over a non-object) replaces the base value.
+ */
+inline void deep_merge(nlohmann::json &base, const nlohmann::json &overlay)
+{
+    if (base.is_object() && overlay.is_object())
+    {
+        for (const auto &[key, val] : overlay.items())
+        {
+            if (base.contains(key) && base[key].is_object() && val.is_object())
+            {
+                deep_merge(base[key], val);
+            }
+            else
+            {
+                base[key] = val;
+            }
+        }
+    }
+    else
+    {
+        base = overlay;
+    }
+}
+
+/**
+ * @brief deep_merge() that moves @p overlay's subtrees into @p base instead of copying them.
+ */
+inline void deep_merge(nlohmann::json &base, nlohmann::json &&overlay)
+{
+    if (base.is_object() && overlay.is_object())
+    {
+        for (auto &[key, val] : overlay.items())
+        {
+            const auto it = base.find(key);
+            if (it != base.end() && it->is_object() && val.is_object())
+            {
+                deep_merge(*it, std::move(val));
+            }
+            else
+            {
+                base[key] = std::move(val);
+            }
+        }
+    }
+    else
+    {
+        base = std::move(overlay);
+    }
+}
+
+/**
+ * @brief True if deep_merge(base, overlay) would modify @p base.
+ */
+inline bool merge_changes(const nlohmann::json &base, const nlohmann::json &overlay)
+{
+    if (!base.is_object() || !overlay.is_object())
+        return base != overlay;
+    for (const auto &[key, val] : overlay.items())
+    {
+        const auto it = base.find(key);
+        if (it == base.end() || merge_changes(*it, val))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Ordered source layers of a layered store (see StoreOptions::layered).
+ *
+ * Layers are held lowest priority first: "file", one layer per file passed to
+ * load_layered() in first-load order, "env", and "runtime".  The store's
+ * defaults tree is passed to each call as an implicit base layer named
+ * "defaults".  Layers combine as deep_merge() applied in order, and because a
+ * non-object replaces everything beneath it, the effective value of a single
+ * key can be computed from the layers alone: merged() and source() never
+ * build the full merge.
+ *
+ * Not synchronized; the store guards it with its mutex.
+ */
+class LayerStack
+{
+    using json = nlohmann::json;
+
+    struct Layer
+    {
+        std::string name;
+        json tree;
+    };
+
+    std::vector<Layer> layers_;
+
+    // What one layer contributes to a key under deep_merge().
+    enum class Hit
+    {
+        None,    // the layer does not reach the key
+        Merge,   // the layer holds the key below objects only
+        Replace, // the layer holds the key inside an array, which replaces lower layers wholesale
+        Hide     // a scalar or array above the key replaces it in lower layers without holding it
+    };
+
+    static Hit probe(const json &tree, std::string_view key, const json *&node)
+    {
+        if (key.starts_with('/'))
+            key.remove_prefix(1);
+        const json *current = &tree;
+        bool in_array       = false;
+        while (true)
+        {
+            if (!current->is_object())
+            {
+                if (!current->is_array())
+                    return Hit::Hide;
+                in_array = true;
+            }
+            const size_t slash = key.find('/');
+            const json *next   = json_path::child(*current, key.substr(0, slash));
+            if (!next)
+                return in_array ? Hit::Hide : Hit::None;
+            if (slash == std::string_view::npos)
+            {
+                node = next;
+                return in_array ? Hit::Replace : Hit::Merge;
+            }
+            current = next;
+            key.remove_prefix(slash + 1);
+        }
+    }
+
+    static void apply(std::optional<json> &value, const json &tree, std::string_view key)
+    {
+        const json *node = nullptr;
+        switch (probe(tree, key, node))
+        {
+        case Hit::None:
+            break;
+        case Hit::Hide:
+            value.reset();
+            break;
+        case Hit::Replace:
+            value = *node;
+            break;
+        case Hit::Merge:
+            if (value)
+                deep_merge(*value, *node);
+            else
+                value = *node;
+            break;
+        }
+    }
+
+    // Returns false if tree has no member at key.
+    static bool erase_from(json &tree, std::string_view key)
+    {
+        try
+        {
+            const json::json_pointer ptr("/" + std::string(key));
+            if (!tree.contains(ptr))
+                return false;
+            json &parent = tree.at(ptr.parent_pointer());
+            return parent.is_object() && parent.erase(ptr.back()) > 0;
+        }
+        catch (const json::exception &)
+        {
+            return false;
+        }
+    }
+
+  public:
+    static constexpr std::string_view defaults_name = "defaults";
+
+    LayerStack()
+    {
+        clear();
+    }
+
+    json &file() noexcept
+    {
+        return layers_.front().tree;
+    }
+
+    json &env() noexcept
+    {
+        return layers_[layers_.size() - 2].tree;
+    }
+
+    json &runtime() noexcept
+    {
+        return layers_.back().tree;
+    }
+
+    /**
+     * @brief Returns the load_layered() layer called @p name.
+     *
+     * A new layer is inserted empty just below "env", i.e. above every file
+     * layered before it.
+     */
+    json &overlay(const std::string &name)
+    {
+        for (size_t i = 1; i + 2 < layers_.size(); ++i)
+        {
+            if (layers_[i].name == name)
+                return layers_[i].tree;
+        }
+        return layers_.insert(layers_.end() - 2, Layer{name, json::object()})->tree;
+    }
+
+    // Layer names, lowest priority first, starting with the implicit defaults layer.
+    std::vector<std::string> names() const
+    {
+        std::vector<std::string> out{std::string(defaults_name)};
+        for (const auto &layer : layers_)
+            out.push_back(layer.name);
+        return out;
+    }
+
+    // Empties every layer and drops the load_layered() layers.
+    void clear()
+    {
+        layers_.clear();
+        layers_.push_back({"file", json::object()});
+        layers_.push_back({"env", json::object()});
+        layers_.push_back({"runtime", json::object()});
+    }
+
+    // Erases a non-empty canonical key from every layer; false if none held it.  Array elements are left in place.
+    bool erase(std::string_view key)
+    {
+        if (key.starts_with('/'))
+            key.remove_prefix(1);
+        bool erased = false;
+        for (auto &layer : layers_)
+            erased = erase_from(layer.tree, key) || erased;
+        return erased;
+    }
+
+    // Full merge of base and every layer.  Pass an empty object as base to leave the defaults out.
+    json flatten(const json &base) const
+    {
+        json out = base;
+        for (const auto &layer : layers_)
+            deep_merge(out, layer.tree);
+        return out;
+    }
+
+    /**
+     * @brief Effective value of a non-empty @p key over base and the layers.
+     * @return The value flatten(base) holds at key, or nullopt if it has none.
+     */
+    std::optional<json> merged(const json &base, std::string_view key) const
+    {
+        std::optional<json> value;
+        apply(value, base, key);
+        for (const auto &layer : layers_)
+            apply(value, layer.tree, key);
+        return value;
+    }
+
+    /**
+     * @brief Name of the highest-priority layer holding @p key.
+     * @return The layer name, or nullopt if the key is absent from the effective view.
+     */
+    std::optional<std::string> source(const json &base, std::string_view key) const
+    {
+        const json *node = nullptr;
+        for (auto it = layers_.rbegin(); it != layers_.rend(); ++it)
+        {
+            switch (probe(it->tree, key, node))
+            {
+            case Hit::None:
+                continue;
+            case Hit::Hide:
+                return std::nullopt;
+            case Hit::Merge:
+            case Hit::Replace:
+                return it->name;
+            }
+        }
+        const Hit hit = probe(base, key, node);
+        if (hit == Hit::Merge || hit == Hit::Replace)
+            return std::string(defaults_name);
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Appends the canonical keys at which @p before and @p after differ.
+     *
+     * Objects are compared member by member and each difference is reported at
+     * the shallowest path where it occurs; arrays and scalars compare whole.
+     * A difference at the root is reported as the empty key.
+     */
+    static void diff(const json &before, const json &after, std::string &path, std::vector<std::string> &out)
+    {
+        if (!before.is_object() || !after.is_object())
+        {
+            if (before != after)
+                out.push_back(path);
+            return;
+        }
+        const size_t length = path.size();
+        const auto extend   = [&](const std::string &name) {
+            path.resize(length);
+            if (length != 0)
+                path += '/';
+            json_path::append_escaped(path, name);
+        };
+        for (const auto &[name, value] : before.items())
+        {
+            extend(name);
+            const auto it = after.find(name);
+            if (it == after.end())
+                out.push_back(path);
+            else
+                diff(value, *it, path, out);
+        }
+        for (const auto &[name, value] : after.items())
+        {
+            if (!before.contains(name))
+            {
+                extend(name);
+                out.push_back(path);
+            }
+        }
+        path.resize(length);
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace config::detail
+{
+
+/**
+ * @brief Top-level sections of a JSON text file that have not been parsed yet (StoreOptions::lazy_sections).
+ *
+ * scan() runs nlohmann's SAX parser over the document once, building nothing,
+ * and notes where the value of each top-level member starts and ends.  Object
+ * values are left pending as byte ranges into the file's text, which the
+ * document keeps alive; every other member is parsed on the spot.  A document
+ * that scans is one json::parse() accepts, so a pending section always
+ * parses.  take() parses a section when it is first needed and drops it from
+ * the document, and a save copies the sections still pending straight from
+ * the original text.
+ */
+class LazyDocument
+{
+    using json = nlohmann::json;
+
+  public:
+    // Raw value text by member name, sorted as the members of a json object are.
+    using Sections = std::map<std::string, std::string_view, std::less<>>;
+
+  private:
+    std::shared_ptr<const std::string> text_;
+    Sections sections_;
+
+    static json parse_text(const std::string_view text)
+    {
+        return json::parse(text.data(), text.data() + text.size());
+    }
+
+    static bool space(const char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    // Input iterator over the text whose position lives in a variable the Scanner reads, so SAX events can be
+    // mapped back to byte offsets.  The end iterator holds no position of its own.
+    class Cursor
+    {
+        const char **at_;
+        const char *end_;
+
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = char;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const char *;
+        using reference         = const char &;
+
+        Cursor(const char **at, const char *end) noexcept : at_(at), end_(end)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return **at_;
+        }
+
+        Cursor &operator++() noexcept
+        {
+            ++*at_;
+            return *this;
+        }
+
+        const char *position() const noexcept
+        {
+            return at_ ? *at_ : end_;
+        }
+
+        friend bool operator==(const Cursor &a, const Cursor &b) noexcept
+        {
+            return a.position() == b.position();
+        }
+    };
+
+    // SAX handler recording the text of each member of the root object.  The lexer reads nothing past a
+    // container's bracket, a string's closing quote or a literal before reporting it, and at most one
+    // delimiter past a number, so the cursor marks where each value ends.
+    struct Scanner
+    {
+        const char *const *at;
+        size_t depth = 0;
+        bool object  = true; // cleared, stopping the parse, when the root is not an object
+        std::string name;
+        const char *name_end = nullptr;
+        std::vector<std::pair<std::string, std::string_view>> members;
+
+        explicit Scanner(const char *const *cursor) : at(cursor)
+        {
+        }
+
+        // Records the member named last, whose value ends at end and starts after the ':' following the name.
+        void member(const char *end)
+        {
+            const char *begin = name_end;
+            while (space(*begin) || *begin == ':')
+                ++begin;
+            members.emplace_back(std::move(name), std::string_view(begin, static_cast<size_t>(end - begin)));
+        }
+
+        bool scalar()
+        {
+            if (depth == 0)
+                return object = false;
+            if (depth == 1)
+            {
+                // A number is only reported once the delimiter after it has been read.
+                const char *end = *at;
+                while (space(end[-1]) || end[-1] == ',' || end[-1] == '}' || end[-1] == ']')
+                    --end;
+                member(end);
+            }
+            return true;
+        }
+
+        bool start(const bool is_object)
+        {
+            if (depth == 0 && !is_object)
+                return object = false;
+            ++depth;
+            return true;
+        }
+
+        bool end()
+        {
+            if (--depth == 1)
+                member(*at);
+            return true;
+        }
+
+        bool null()
+        {
+            return scalar();
+        }
+        bool boolean(bool)
+        {
+            return scalar();
+        }
+        bool number_integer(json::number_integer_t)
+        {
+            return scalar();
+        }
+        bool number_unsigned(json::number_unsigned_t)
+        {
+            return scalar();
+        }
+        bool number_float(json::number_float_t, const std::string &)
+        {
+            return scalar();
+        }
+        bool string(std::string &)
+        {
+            return scalar();
+        }
+        bool binary(json::binary_t &)
+        {
+            return scalar();
+        }
+        bool start_object(std::size_t)
+        {
+            return start(true);
+        }
+        bool key(std::string &text)
+        {
+            if (depth == 1)
+            {
+                name     = std::move(text);
+                name_end = *at;
+            }
+            return true;
+        }
+        bool end_object()
+        {
+            return end();
+        }
+        bool start_array(std::size_t)
+        {
+            return start(false);
+        }
+        bool end_array()
+        {
+            return end();
+        }
+        bool parse_error(std::size_t, const std::string &, const json::exception &)
+        {
+            return false;
+        }
+    };
+
+  public:
+    /**
+     * @brief Splits a JSON object document into parsed members and pending sections.
+     *
+     * Members whose value is not an object, and the member named @p eager, are
+     * parsed into @p head; the other members are left pending.  Later
+     * duplicates of a name win, as with json::parse().
+     *
+     * @return The pending sections, or nullptr if @p text is not a single
+     *         well-formed JSON object.
+     */
+    static std::shared_ptr<LazyDocument> scan(std::shared_ptr<const std::string> text, const std::string_view eager,
+                                              json &head)
+    {
+        auto document            = std::make_shared<LazyDocument>();
+        document->text_          = std::move(text);
+        const std::string_view s = *document->text_;
+        const char *at           = s.data();
+        const char *const end    = s.data() + s.size();
+        Scanner scanner(&at);
+        head = json::object();
+        try
+        {
+            if (!json::sax_parse(Cursor(&at, end), Cursor(nullptr, end), &scanner) || !scanner.object)
+                return nullptr;
+            for (auto &[name, value] : scanner.members)
+            {
+                if (value.front() == '{' && name != eager)
+                {
+                    head.erase(name);
+                    document->sections_.insert_or_assign(std::move(name), value);
+                }
+                else
+                {
+                    document->sections_.erase(name);
+                    head[name] = parse_text(value);
+                }
+            }
+        }
+        catch (const json::exception &)
+        {
+            return nullptr;
+        }
+        return document;
+    }
+
+    bool empty() const noexcept
+    {
+        return sections_.empty();
+    }
+
+    // True if section name is pending; an empty name asks whether any section is.
+    bool pending(const std::string_view name) const
+    {
+        return name.empty() ? !sections_.empty() : sections_.find(name) != sections_.end();
+    }
+
+    const Sections &sections() const noexcept
+    {
+        return sections_;
+    }
+
+    // Parses the pending section name and stops tracking it.
+    json take(const std::string_view name)
+    {
+        const auto it = sections_.find(name);
+        json value    = parse_text(it->second);
+        sections_.erase(it);
+        return value;
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/atomic_shared_ptr.hpp>
+#include <config/detail/json_path.hpp>
+
+namespace config
+{
+
+namespace detail
+{
+
+/**
+ * @brief Store-side half of a value mirrored outside the store lock.
+ *
+ * The store calls refresh() with the exclusive lock held after every write
+ * that changed data_ or defaults_ at a key overlapping key(), so each mirror
+ * has a single writer.
+ */
+class Mirror
+{
+  public:
+    virtual ~Mirror()                                                                = default;
+    virtual void refresh(const nlohmann::json &data, const nlohmann::json &defaults) = 0;
+    virtual const std::string &key() const noexcept                                  = 0;
+};
+
+template <typename T> inline constexpr bool live_lock_free_v = false;
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+inline constexpr bool live_lock_free_v<T> = std::atomic<T>::is_always_lock_free;
+
+// Holds the current value of one key, converted to T.
+template <typename T> class LiveCell final : public Mirror
+{
+    std::string key_;
+    T default_;
+    std::conditional_t<live_lock_free_v<T>, std::atomic<T>, AtomicSharedPtr<const T>> value_;
+
+    void publish(const T &value)
+    {
+        if constexpr (live_lock_free_v<T>)
+            value_.store(value, std::memory_order_release);
+        else
+            value_.store(std::make_shared<const T>(value));
+    }
+
+  public:
+    LiveCell(std::string key, T default_value) : key_(std::move(key)), default_(std::move(default_value))
+    {
+    }
+
+    void refresh(const nlohmann::json &data, const nlohmann::json &defaults) override
+    {
+        for (const nlohmann::json *layer : {&data, &defaults})
+        {
+            if (const nlohmann::json *node = json_path::find_node(*layer, key_))
+            {
+                try
+                {
+                    publish(node->template get<T>());
+                    return;
+                }
+                catch (...)
+                {
+                    // Type mismatch: fall through to the next layer
+                }
+            }
+        }
+        publish(default_);
+    }
+
+    auto load() const noexcept
+    {
+        if constexpr (live_lock_free_v<T>)
+            return value_.load(std::memory_order_acquire);
+        else
+            return value_.load();
+    }
+
+    const std::string &key() const noexcept override
+    {
+        return key_;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Handle to a key whose value the store keeps current on every write.
+ *
+ * Returned by ConfigStore::live().  load() never takes the store lock: it is a
+ * single atomic load returning T when T is trivially copyable and lock-free
+ * as std::atomic<T>, and a std::shared_ptr<const T> otherwise.  The handle
+ * may outlive its store, in which case it keeps the last value.
+ *
+ * @tparam T Value type the key is read as.
+ */
+template <typename T> class Live
+{
+    std::shared_ptr<detail::LiveCell<T>> cell_;
+
+  public:
+    /// True when load() returns T rather than std::shared_ptr<const T>.
+    static constexpr bool is_lock_free = detail::live_lock_free_v<T>;
+
+    explicit Live(std::shared_ptr<detail::LiveCell<T>> cell) : cell_(std::move(cell))
+    {
+    }
+
+    /**
+     * @brief Returns the current value.
+     * @return T, or std::shared_ptr<const T> when is_lock_free is false.
+     */
+    [[nodiscard]] auto load() const noexcept
+    {
+        return cell_->load();
+    }
+
+    /**
+     * @brief Returns the key this handle mirrors.
+     */
+    [[nodiscard]] const std::string &key() const noexcept
+    {
+        return cell_->key();
+    }
+};
+
+} // namespace config
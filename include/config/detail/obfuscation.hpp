@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <format>
+#include <memory>
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <config/detail/types.hpp>
 
@@ -220,4 +222,72 @@ class ObfuscationEngine
     }
 };
 
+/**
+ * @brief Copy-on-write map from key to the Encoding applied to its value.
+ *
+ * Like CowJson, all members must be called with the owning store's mutex
+ * held, and mut() clones the map while a copy or pin() holder still shares
+ * it.  Copying an ObfuscationMap is therefore O(1), which lets save() and
+ * transaction rollback keep the map without duplicating it.
+ */
+class ObfuscationMap
+{
+  public:
+    using Map = std::unordered_map<std::string, Encoding>;
+
+  private:
+    std::shared_ptr<Map> map_ = std::make_shared<Map>();
+
+  public:
+    const Map &get() const noexcept
+    {
+        return *map_;
+    }
+
+    Map &mut()
+    {
+        if (map_.use_count() > 1)
+            map_ = std::make_shared<Map>(*map_);
+        return *map_;
+    }
+
+    // Shares the current map; callers must release it with the store's mutex held.
+    std::shared_ptr<const Map> pin() const noexcept
+    {
+        return map_;
+    }
+
+    bool empty() const noexcept
+    {
+        return map_->empty();
+    }
+
+    // Encoding recorded for key, None if there is none.
+    Encoding encoding(const std::string &key) const
+    {
+        const auto it = map_->find(key);
+        return it == map_->end() ? Encoding::None : it->second;
+    }
+
+    // Records key's encoding; None removes the entry.  Leaves a shared map alone when nothing changes.
+    void assign(const std::string &key, const Encoding encoding)
+    {
+        if (encoding == Encoding::None)
+        {
+            if (map_->contains(key))
+                mut().erase(key);
+        }
+        else if (this->encoding(key) != encoding)
+        {
+            mut()[key] = encoding;
+        }
+    }
+
+    void clear()
+    {
+        if (!map_->empty())
+            map_ = std::make_shared<Map>();
+    }
+};
+
 } // namespace config::detail
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/json_path.hpp>
+#include <config/detail/string_hash.hpp>
+
+namespace config
+{
+
+/**
+ * @brief Counters describing a store's path index (see StoreOptions::index_paths).
+ */
+struct IndexStats
+{
+    size_t entries = 0; ///< Paths currently indexed.
+    size_t builds  = 0; ///< Full rebuilds performed so far.
+};
+
+namespace detail
+{
+
+/**
+ * @brief Flat map from canonical key to the node it names in one JSON tree.
+ *
+ * Canonical keys are the JSON Pointer path without its leading slash
+ * ("server/port", "a~1b").  Objects are indexed recursively; arrays are indexed
+ * as leaves because their elements move when the array is resized.  find()
+ * answers a key below an array by walking from the deepest indexed ancestor;
+ * any other miss means the key is absent.
+ *
+ * Writers, holding the store mutex exclusively, keep the index current with
+ * erase_subtree() / insert_path() or drop it with invalidate().  Readers,
+ * holding it shared, call find(), which rebuilds a dropped index on first use.
+ */
+class PathIndex
+{
+    using json = nlohmann::json;
+
+    std::unordered_map<std::string, const json *, StringHash, std::equal_to<>> nodes_;
+    const json *root_ = nullptr;
+    std::atomic<bool> valid_{false};
+    mutable std::mutex build_mutex_;
+    size_t builds_ = 0;
+
+    // Visits node and, unless it is an array or scalar, every descendant.
+    template <typename Fn> static void walk(std::string &path, const json &node, Fn &&fn)
+    {
+        fn(path, node);
+        if (!node.is_object())
+            return;
+        const size_t length = path.size();
+        for (const auto &[name, child] : node.items())
+        {
+            path += '/';
+            json_path::append_escaped(path, name);
+            walk(path, child, fn);
+            path.resize(length);
+        }
+    }
+
+    void rebuild(const json &root)
+    {
+        nodes_.clear();
+        if (root.is_object())
+        {
+            std::string path;
+            for (const auto &[name, child] : root.items())
+            {
+                path.clear();
+                json_path::append_escaped(path, name);
+                walk(path, child, [this](const std::string &p, const json &n) { nodes_.emplace(p, &n); });
+            }
+        }
+        root_ = &root;
+        ++builds_;
+    }
+
+  public:
+    /**
+     * @brief Looks up a canonical key, rebuilding the index for @p root if it was dropped.
+     *
+     * The key always names a node below @p root: "" is the member with an
+     * empty name, as "/" is in JSON Pointer.
+     *
+     * @return The node, or nullptr if @p root has no such key.
+     */
+    const json *find(const json &root, std::string_view key)
+    {
+        if (!valid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard lock(build_mutex_);
+            if (!valid_.load(std::memory_order_relaxed))
+            {
+                rebuild(root);
+                valid_.store(true, std::memory_order_release);
+            }
+        }
+        // Strip segments until an indexed ancestor is found.  Objects are indexed in full, so only the part of the
+        // key below an array still has to be walked.
+        const json *node       = &root;
+        std::string_view found = key;
+        bool indexed           = false;
+        while (true)
+        {
+            if (const auto it = nodes_.find(found); it != nodes_.end())
+            {
+                node    = it->second;
+                indexed = true;
+                break;
+            }
+            const size_t slash = found.rfind('/');
+            if (slash == std::string_view::npos)
+                break;
+            found = found.substr(0, slash);
+        }
+        if (indexed && found.size() == key.size())
+            return node;
+        if (!node->is_array())
+            return nullptr;
+        std::string_view rest = indexed ? key.substr(found.size() + 1) : key;
+        while (node)
+        {
+            const size_t slash = rest.find('/');
+            node               = json_path::child(*node, rest.substr(0, slash));
+            if (slash == std::string_view::npos)
+                return node;
+            rest.remove_prefix(slash + 1);
+        }
+        return nullptr;
+    }
+
+    // True when the index describes root and may be updated in place.
+    bool tracks(const json &root) const noexcept
+    {
+        return valid_.load(std::memory_order_relaxed) && root_ == &root;
+    }
+
+    void invalidate() noexcept
+    {
+        valid_.store(false, std::memory_order_release);
+    }
+
+    // Call before the node at key is overwritten or erased.
+    void erase_subtree(std::string_view key, const json &node)
+    {
+        std::string path(key);
+        walk(path, node, [this](const std::string &p, const json &) { nodes_.erase(p); });
+    }
+
+    // Call after key was assigned: indexes the ancestors it may have created, then the new subtree.
+    void insert_path(const json &root, std::string_view key)
+    {
+        const json *node = &root;
+        size_t begin     = 0;
+        while (true)
+        {
+            if (!node->is_object())
+                return; // nothing below an array is indexed
+            const size_t slash = key.find('/', begin);
+            const size_t end   = slash == std::string_view::npos ? key.size() : slash;
+            node               = json_path::child(*node, key.substr(begin, end - begin));
+            if (!node)
+                return;
+            if (slash == std::string_view::npos)
+                break;
+            nodes_.try_emplace(std::string(key.substr(0, end)), node);
+            begin = end + 1;
+        }
+        std::string path(key);
+        walk(path, *node, [this](const std::string &p, const json &n) { nodes_.insert_or_assign(p, &n); });
+    }
+
+    IndexStats stats() const
+    {
+        std::lock_guard lock(build_mutex_);
+        return {valid_.load(std::memory_order_relaxed) ? nodes_.size() : 0, builds_};
+    }
+};
+
+} // namespace detail
+} // namespace config
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM64)
+#include <intrin.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/json_path.hpp>
+
+namespace config::detail
+{
+
+// Spin-wait hint for one retry of a sequence lock read: lets a sibling hyperthread (often the writer) run
+// and keeps the loop from flooding the memory system with loads of the line being written.
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(_M_ARM64)
+    __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+template <typename T>
+concept SlotScalar = std::is_arithmetic_v<T> && sizeof(T) <= sizeof(std::uint64_t);
+
+/**
+ * @brief One scalar value published through a sequence lock.
+ *
+ * The single writer (the store, under its exclusive lock) makes seq_ odd,
+ * stores the payload, then makes seq_ even again.  Readers retry until they
+ * observe the same even sequence before and after reading the payload, so a
+ * read is a handful of plain atomic loads with no read-modify-write.  Each
+ * slot owns a cache line so readers of one key never share a line with
+ * writes to another.
+ */
+struct alignas(64) ScalarSlot
+{
+    std::atomic<std::uint32_t> seq_{0};
+    std::atomic<std::uint64_t> bits_{0};
+    std::atomic<bool> present_{false};
+    std::string key_;
+    // Converts the node to the slot's type and encodes it into bits; false on type mismatch.
+    bool (*convert_)(const nlohmann::json &, std::uint64_t &) = nullptr;
+
+    template <SlotScalar T> static bool convert(const nlohmann::json &node, std::uint64_t &bits)
+    {
+        T value{};
+        try
+        {
+            value = node.get<T>();
+        }
+        catch (const nlohmann::json::exception &)
+        {
+            return false;
+        }
+        bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        return true;
+    }
+
+    void publish(const bool present, const std::uint64_t bits) noexcept
+    {
+        const std::uint32_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bits_.store(bits, std::memory_order_relaxed);
+        present_.store(present, std::memory_order_relaxed);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reads the slot.
+     * @return false if the key is currently missing or not convertible to T.
+     */
+    template <SlotScalar T> bool read(T &out) const noexcept
+    {
+        std::uint64_t bits = 0;
+        bool present       = false;
+        while (true)
+        {
+            const std::uint32_t before = seq_.load(std::memory_order_acquire);
+            if (!(before & 1u))
+            {
+                bits    = bits_.load(std::memory_order_relaxed);
+                present = present_.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (seq_.load(std::memory_order_relaxed) == before)
+                    break;
+            }
+            cpu_relax();
+        }
+        if (!present)
+            return false;
+        std::memcpy(&out, &bits, sizeof(T));
+        return true;
+    }
+};
+
+/**
+ * @brief Registry of scalar slots mirroring registered keys.
+ *
+ * Slots live in a deque so their addresses stay valid for the lifetime of
+ * the store.  add() and refresh() require the store mutex held exclusively.
+ * A write that changed one key refreshes only the slots whose keys overlap
+ * it, unless it runs through an array; any other write refreshes them all.
+ */
+class ScalarSlots
+{
+    std::deque<ScalarSlot> slots_;
+
+    static void refresh_one(ScalarSlot &slot, const nlohmann::json &data, const nlohmann::json &defaults)
+    {
+        for (const nlohmann::json *layer : {&data, &defaults})
+        {
+            if (const nlohmann::json *node = json_path::find_node(*layer, slot.key_))
+            {
+                std::uint64_t bits = 0;
+                if (slot.convert_(*node, bits))
+                {
+                    slot.publish(true, bits);
+                    return;
+                }
+            }
+        }
+        slot.publish(false, 0);
+    }
+
+  public:
+    template <SlotScalar T>
+    const ScalarSlot *add(std::string key, const nlohmann::json &data, const nlohmann::json &defaults)
+    {
+        ScalarSlot &slot = slots_.emplace_back();
+        slot.key_        = std::move(key);
+        slot.convert_    = &ScalarSlot::convert<T>;
+        refresh_one(slot, data, defaults);
+        return &slot;
+    }
+
+    bool empty() const noexcept
+    {
+        return slots_.empty();
+    }
+
+    // Republishes the slots a write at scope may have changed, or every slot when scope is empty.
+    void refresh(const nlohmann::json &data, const nlohmann::json &defaults,
+                 const std::optional<std::string_view> scope = std::nullopt)
+    {
+        for (auto &slot : slots_)
+        {
+            if (!scope || json_path::overlaps(slot.key_, *scope))
+                refresh_one(slot, data, defaults);
+        }
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include <config/detail/json_path.hpp>
+
+namespace config
+{
+
+namespace detail
+{
+
+/**
+ * @brief String literal usable as a template argument.
+ */
+template <size_t N> struct FixedString
+{
+    char chars[N]{};
+
+    consteval FixedString(const char (&literal)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            chars[i] = literal[i];
+    }
+
+    constexpr std::string_view view() const noexcept
+    {
+        return {chars, N - 1};
+    }
+};
+
+// True for a non-empty key whose every '~' starts a ~0 or ~1 escape.
+consteval bool valid_key(std::string_view key)
+{
+    if (key.empty())
+        return false;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        if (key[i] == '~' && (i + 1 == key.size() || (key[i + 1] != '0' && key[i + 1] != '1')))
+            return false;
+    }
+    return true;
+}
+
+consteval size_t count_segments(std::string_view canonical)
+{
+    size_t count = 1;
+    for (const char c : canonical)
+        count += c == '/' ? 1 : 0;
+    return count;
+}
+
+// Unescaped segment names packed back to back.
+template <size_t Size> consteval std::array<char, Size> pack_names(std::string_view canonical)
+{
+    std::array<char, Size> names{};
+    size_t out = 0;
+    for (size_t i = 0; i < canonical.size(); ++i)
+    {
+        if (canonical[i] == '/')
+            continue;
+        if (canonical[i] == '~')
+            names[out++] = canonical[++i] == '0' ? '~' : '/';
+        else
+            names[out++] = canonical[i];
+    }
+    return names;
+}
+
+template <size_t Count>
+consteval std::array<json_path::Segment, Count> split_segments(std::string_view canonical, const char *names)
+{
+    std::array<json_path::Segment, Count> segments{};
+    size_t segment = 0;
+    size_t begin   = 0;
+    size_t length  = 0;
+    for (size_t i = 0; i <= canonical.size(); ++i)
+    {
+        if (i == canonical.size() || canonical[i] == '/')
+        {
+            const std::string_view escaped = canonical.substr(begin, i - begin);
+            size_t index                   = 0;
+            if (!json_path::parse_index(escaped, index))
+                index = static_cast<size_t>(-1);
+            segments[segment++] = {std::string_view(names, length), index};
+            names += length;
+            begin  = i + 1;
+            length = 0;
+        }
+        else if (canonical[i] == '~')
+        {
+            ++i;
+            ++length;
+        }
+        else
+        {
+            ++length;
+        }
+    }
+    return segments;
+}
+
+// Compile-time split of S, shared by every StaticKey<S>.
+template <FixedString S> struct StaticPath
+{
+    static constexpr std::string_view text      = S.view();
+    static constexpr std::string_view canonical = text.starts_with('/') ? text.substr(1) : text;
+    static constexpr size_t count               = count_segments(canonical);
+    static constexpr std::array<char, canonical.size() + 1> names = pack_names<canonical.size() + 1>(canonical);
+    static constexpr std::array<json_path::Segment, count> segments = split_segments<count>(canonical, names.data());
+};
+
+} // namespace detail
+
+/**
+ * @brief Key checked and split into segments at compile time.
+ *
+ * Spelled config::key<"server/port"> or CONFIG_KEY("server/port").  A key that
+ * is empty or contains a '~' not followed by '0' or '1' fails to compile.
+ * Reads through a StaticKey walk the pre-split segments, so they do no string
+ * scanning or unescaping at run time; writes reuse one JSON Pointer parsed on
+ * first use.  Converts to std::string_view, so it can also be passed to any
+ * ConfigStore member that takes a key string.
+ *
+ * @tparam S The key literal.
+ */
+template <detail::FixedString S> class StaticKey
+{
+    static_assert(detail::valid_key(S.view()),
+                  "config::key: malformed key (it must be non-empty, and '~' must be followed by '0' or '1')");
+
+    using Path = detail::StaticPath<S>;
+
+  public:
+    /**
+     * @brief Returns the key exactly as written.
+     */
+    static constexpr std::string_view str() noexcept
+    {
+        return Path::text;
+    }
+
+    /**
+     * @brief Returns the key's pre-split segments.
+     */
+    static constexpr detail::json_path::SplitKey split() noexcept
+    {
+        return {Path::text, Path::segments};
+    }
+
+    /**
+     * @brief Returns the key as a JSON Pointer, parsed once per key literal.
+     */
+    static const nlohmann::json::json_pointer &pointer()
+    {
+        static const nlohmann::json::json_pointer ptr("/" + std::string(Path::canonical));
+        return ptr;
+    }
+
+    constexpr operator std::string_view() const noexcept
+    {
+        return Path::text;
+    }
+};
+
+/**
+ * @brief Compile-time key constant; see StaticKey.
+ */
+template <detail::FixedString S> inline constexpr StaticKey<S> key{};
+
+} // namespace config
+
+/**
+ * @brief Compile-time validated key: CONFIG_KEY("server/port") is config::key<"server/port">.
+ */
+#define CONFIG_KEY(literal) (::config::key<literal>)
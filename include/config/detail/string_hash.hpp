@@ -0,0 +1,30 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace config::detail
+{
+
+/**
+ * @brief Transparent string hash for heterogeneous lookup in unordered containers.
+ */
+struct StringHash
+{
+    using is_transparent = void;
+    size_t operator()(std::string_view sv) const
+    {
+        return std::hash<std::string_view>{}(sv);
+    }
+    size_t operator()(const std::string &s) const
+    {
+        return std::hash<std::string>{}(s);
+    }
+    size_t operator()(const char *s) const
+    {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+} // namespace config::detail
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+
+namespace config::detail
+{
+
+/**
+ * @brief Reader/writer locks for the sections of a Concurrency::Striped store.
+ *
+ * A section is the first @c depth segments of a canonical key ("metrics" or
+ * "metrics/http" for "metrics/http/requests").  Sections hash onto a fixed
+ * table of stripes, each padded to its own cache line; two sections sharing
+ * a stripe merely serialize.  Keys shallower than a section touch every
+ * section below them and are covered by all stripes.
+ *
+ * Stripes are always taken in ascending index order, and only while the
+ * store mutex is held shared, so they never deadlock against each other or
+ * against a writer holding the store mutex exclusively.  A table built with
+ * depth 0 is disabled: it owns no locks and covers nothing.
+ */
+class StripeLocks
+{
+  public:
+    static constexpr size_t count = 32;
+    using Set                     = std::bitset<count>;
+
+  private:
+    struct alignas(64) Stripe
+    {
+        std::shared_mutex mutex;
+    };
+
+    std::unique_ptr<Stripe[]> stripes_;
+    size_t depth_;
+
+    static std::string_view canonical(std::string_view key) noexcept
+    {
+        return key.starts_with('/') ? key.substr(1) : key;
+    }
+
+    // First depth_ segments of a canonical key, or nullopt if it has fewer.
+    std::optional<std::string_view> section(const std::string_view key) const noexcept
+    {
+        if (key.empty())
+            return std::nullopt;
+        size_t end = 0;
+        for (size_t segment = 1; segment < depth_; ++segment)
+        {
+            end = key.find('/', end);
+            if (end == std::string_view::npos)
+                return std::nullopt;
+            ++end;
+        }
+        return key.substr(0, key.find('/', end));
+    }
+
+    static size_t index(const std::string_view section) noexcept
+    {
+        return std::hash<std::string_view>{}(section) % count;
+    }
+
+  public:
+    explicit StripeLocks(const size_t depth)
+        : stripes_(depth == 0 ? nullptr : std::make_unique<Stripe[]>(count)), depth_(depth)
+    {
+    }
+
+    bool enabled() const noexcept
+    {
+        return depth_ != 0;
+    }
+
+    /**
+     * @brief Stripe that guards writes to @p key, or nullopt if the key is not inside one section.
+     * @param strict Require the key to lie strictly below its section (for removals, which edit the parent).
+     */
+    std::optional<size_t> stripe_of(std::string_view key, const bool strict = false) const noexcept
+    {
+        if (!enabled())
+            return std::nullopt;
+        key               = canonical(key);
+        const auto prefix = section(key);
+        if (!prefix || (strict && prefix->size() == key.size()))
+            return std::nullopt;
+        return index(*prefix);
+    }
+
+    // Section of key for a caller that already got its stripe from stripe_of().
+    std::string_view section_of(const std::string_view key) const noexcept
+    {
+        return section(canonical(key)).value_or(std::string_view());
+    }
+
+    /**
+     * @brief Stripes a read of @p key must hold: its section's stripe, or every stripe.
+     * @return The empty set when the table is disabled.
+     */
+    Set cover(const std::string_view key) const noexcept
+    {
+        if (!enabled())
+            return {};
+        const auto prefix = section(canonical(key));
+        if (!prefix)
+            return Set().set();
+        return Set().set(index(*prefix));
+    }
+
+    std::shared_mutex &at(const size_t stripe) const noexcept
+    {
+        return stripes_[stripe].mutex;
+    }
+
+    /**
+     * @brief Shared hold on a set of stripes, acquired in ascending order and released on destruction.
+     */
+    class Shared
+    {
+        const StripeLocks *locks_ = nullptr;
+        Set held_;
+
+      public:
+        Shared() = default;
+
+        // Holds every stripe of locks.
+        explicit Shared(const StripeLocks &locks)
+        {
+            lock(locks, Set().set());
+        }
+
+        Shared(const Shared &)            = delete;
+        Shared &operator=(const Shared &) = delete;
+
+        ~Shared()
+        {
+            for (size_t i = count; i-- > 0;)
+            {
+                if (held_.test(i))
+                    locks_->stripes_[i].mutex.unlock_shared();
+            }
+        }
+
+        // Takes the stripes in set; a no-op on a disabled table.  Call at most once.
+        void lock(const StripeLocks &locks, const Set &set)
+        {
+            if (!locks.enabled())
+                return;
+            locks_ = &locks;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (set.test(i))
+                {
+                    locks_->stripes_[i].mutex.lock_shared();
+                    held_.set(i);
+                }
+            }
+        }
+    };
+};
+
+} // namespace config::detail
@@ -22,6 +22,18 @@ enum class JsonFormat
     Compact ///< Minified output without whitespace.
 };
 
+/**
+ * @brief Enum defining the encoding of configuration files on disk.
+ */
+enum class FileFormat
+{
+    Json,        ///< JSON text, laid out by JsonFormat.
+    MessagePack, ///< MessagePack binary encoding.
+    Cbor,        ///< CBOR binary encoding (RFC 8949).
+    Bson,        ///< BSON binary encoding; the document root must be an object.
+    Ubjson       ///< UBJSON binary encoding.
+};
+
 /**
  * @brief Enum defining available encoding methods.
  */
@@ -40,8 +52,19 @@ enum class Encoding
  */
 enum class SaveStrategy
 {
-    Auto,  ///< Automatically save to disk after every 'set' operation.
-    Manual ///< Only save to disk when 'save()' is explicitly called.
+    Auto,     ///< Automatically save to disk after every 'set' operation.
+    Manual,   ///< Only save to disk when 'save()' is explicitly called.
+    Debounced ///< Save from a background thread once writes pause (see StoreOptions::save_quiet_period).
+};
+
+/**
+ * @brief Enum defining how hard a save pushes the file to stable storage.
+ */
+enum class Durability
+{
+    None,  ///< Write the file in place and leave flushing to the OS.
+    Sync,  ///< Write the file in place and fdatasync it before the save reports success.
+    Atomic ///< Write and sync a temporary file, then rename it over the file.
 };
 
 /**
@@ -53,4 +76,25 @@ enum class MissingKeyPolicy
     ThrowException ///< Throw a std::runtime_error if key is missing.
 };
 
+/**
+ * @brief Enum defining how readers are synchronized with writers.
+ */
+enum class Concurrency
+{
+    Locked,   ///< Readers take a shared lock on the store mutex.
+    Snapshot, ///< Readers pin an immutable snapshot without locking; writers copy the tree on write.
+    Striped   ///< Like Locked, plus per-section locks so writers to different sections run in parallel.
+};
+
+/**
+ * @brief Enum describing why a try_* accessor produced no value.
+ */
+enum class Error
+{
+    KeyNotFound,  ///< The key exists in neither the data nor the defaults.
+    TypeMismatch, ///< The key exists but cannot be converted to the requested type.
+    InvalidKey,   ///< The key cannot be written (e.g. a path segment is a scalar).
+    SaveFailed    ///< The value was written in memory but the auto-save failed.
+};
+
 } // namespace config
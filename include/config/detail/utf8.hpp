@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace config::detail
+{
+
+// Length of the UTF-8 sequence starting at text[i], or 0 if it is malformed (RFC 3629).
+inline size_t utf8_sequence_length(const std::string_view text, const size_t i)
+{
+    const auto byte = [&](const size_t k) { return static_cast<unsigned char>(text[k]); };
+    const unsigned char lead = byte(i);
+    size_t length            = 0;
+    unsigned char low        = 0x80;
+    unsigned char high       = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF)
+        length = 2;
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 3;
+        low    = lead == 0xE0 ? 0xA0 : 0x80;
+        high   = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 4;
+        low    = lead == 0xF0 ? 0x90 : 0x80;
+        high   = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+        return 0;
+    if (i + length > text.size() || byte(i + 1) < low || byte(i + 1) > high)
+        return 0;
+    for (size_t k = 2; k < length; ++k)
+    {
+        if (byte(i + k) < 0x80 || byte(i + k) > 0xBF)
+            return 0;
+    }
+    return length;
+}
+
+} // namespace config::detail
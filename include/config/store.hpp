@@ -3,18 +3,26 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -24,8 +32,25 @@
 
 #include <nlohmann/json.hpp>
 
+#include <config/detail/conversion_cache.hpp>
+#include <config/detail/convert.hpp>
+#include <config/detail/cow_json.hpp>
+#include <config/detail/expected.hpp>
+#include <config/detail/file_codec.hpp>
+#include <config/detail/file_io.hpp>
+#include <config/detail/journal.hpp>
+#include <config/detail/json_path.hpp>
+#include <config/detail/json_writer.hpp>
+#include <config/detail/layer_stack.hpp>
+#include <config/detail/lazy_document.hpp>
+#include <config/detail/live_value.hpp>
 #include <config/detail/obfuscation.hpp>
+#include <config/detail/path_index.hpp>
 #include <config/detail/path_resolver.hpp>
+#include <config/detail/scalar_slots.hpp>
+#include <config/detail/static_key.hpp>
+#include <config/detail/string_hash.hpp>
+#include <config/detail/stripe_locks.hpp>
 #include <config/detail/types.hpp>
 
 namespace config
@@ -33,6 +58,7 @@ namespace config
 
 // Forward declaration for RAII connection handle.
 class Connection;
+class Txn;
 
 /**
  * @brief Concept to ensure a type can be retrieved from JSON.
@@ -58,7 +84,22 @@ struct StoreOptions
     SaveStrategy save           = SaveStrategy::Auto;
     MissingKeyPolicy on_missing = MissingKeyPolicy::DefaultValue;
     JsonFormat format           = JsonFormat::Pretty;
+    FileFormat file_format      = FileFormat::Json; // the store file's encoding, also used by merge_file/load_layered
     std::string env_prefix; // empty = no env var override; used in B13
+    Concurrency concurrency = Concurrency::Locked;
+    bool cache_conversions  = false; // memoize non-scalar get<T>() results until the next write
+    bool index_paths        = false; // flat key -> node index for large configs (Locked mode only)
+    bool lazy_sections      = false; // parse each top-level object of the file on first access (Locked mode only)
+    size_t stripe_depth     = 1;     // Concurrency::Striped: leading key segments that name a locked section
+    bool layered            = false; // keep defaults, files, env and runtime sets as separate layers
+    bool journal            = false; // Auto save appends each change to <file>.journal instead of rewriting
+    // Journal size past which the writer thread folds it into the file.
+    size_t journal_compact_bytes{size_t{1} << 20};
+    Durability durability = Durability::None; // how far save() and journal appends push data to disk
+    // SaveStrategy::Debounced: write once no mutation has happened for save_quiet_period, and
+    // never later than save_max_delay after the first unsaved mutation.
+    std::chrono::milliseconds save_quiet_period{100};
+    std::chrono::milliseconds save_max_delay{1000};
 };
 
 /**
@@ -83,17 +124,128 @@ class ConfigStore
     using ListenerCallback = std::function<void(const json &)>;
     using ListenerId       = size_t;
 
+    /**
+     * @brief Pre-parsed key handle for repeated access to the same path.
+     *
+     * The key is parsed once at construction into a JSON Pointer, used by the
+     * write overloads taking a Key, and into unescaped segments, which the read
+     * overloads (get, try_get, get_many, contains) walk without scanning or
+     * unescaping the key string again.  Copies share the parsed form.  A Key
+     * may be shared across threads and used with any store; a Key returned by
+     * register_scalar() additionally reads through its store's scalar slot.
+     *
+     * @tparam T Value type the key is read and written as.
+     */
+    template <typename T> class Key
+    {
+        friend class ConfigStore;
+
+        struct Parsed
+        {
+            std::string text;
+            nlohmann::json::json_pointer ptr;
+            std::string names; // unescaped segment names back to back, viewed by segments
+            std::vector<detail::json_path::Segment> segments;
+        };
+
+        std::shared_ptr<const Parsed> parsed_;
+        // Set by register_scalar().  owner_ is the store's id_ rather than its address, so a Key that outlives
+        // its store never matches a later store allocated at the same address.
+        std::uint64_t owner_            = 0;
+        const detail::ScalarSlot *slot_ = nullptr;
+
+      public:
+        /**
+         * @brief Parses @p key into a JSON Pointer and its segments.
+         * @param key Non-empty configuration key or JSON Pointer path.
+         * @throws std::invalid_argument If key is empty or not a valid JSON Pointer.
+         */
+        explicit Key(std::string_view key)
+        {
+            if (key.empty())
+                throw std::invalid_argument("Key requires a non-empty key");
+            auto parsed  = std::make_shared<Parsed>();
+            parsed->text = std::string(key);
+            try
+            {
+                parsed->ptr = nlohmann::json::json_pointer((key.front() == '/') ? parsed->text : "/" + parsed->text);
+            }
+            catch (const nlohmann::json::exception &e)
+            {
+                throw std::invalid_argument(std::format("Invalid key '{}': {}", key, e.what()));
+            }
+            // The pointer accepted every escape, so each segment unescapes cleanly.  Names are appended first
+            // and viewed afterwards, once the buffer no longer moves.
+            const std::string_view canonical = canonical_key(key);
+            std::vector<std::pair<size_t, size_t>> spans;
+            std::string name;
+            size_t begin = 0;
+            while (true)
+            {
+                const size_t slash             = canonical.find('/', begin);
+                const std::string_view escaped = canonical.substr(begin, slash - begin);
+                detail::json_path::unescape(escaped, name);
+                spans.emplace_back(parsed->names.size(), name.size());
+                parsed->names += name;
+                size_t index = 0;
+                if (!detail::json_path::parse_index(escaped, index))
+                    index = static_cast<size_t>(-1);
+                parsed->segments.push_back({{}, index});
+                if (slash == std::string_view::npos)
+                    break;
+                begin = slash + 1;
+            }
+            for (size_t i = 0; i < spans.size(); ++i)
+                parsed->segments[i].name = std::string_view(parsed->names).substr(spans[i].first, spans[i].second);
+            parsed_ = std::move(parsed);
+        }
+
+        /**
+         * @brief Returns the key exactly as it was passed at construction.
+         */
+        const std::string &str() const noexcept
+        {
+            return parsed_->text;
+        }
+
+        /**
+         * @brief Returns the pre-parsed JSON Pointer.
+         */
+        const nlohmann::json::json_pointer &pointer() const noexcept
+        {
+            return parsed_->ptr;
+        }
+
+        /**
+         * @brief Returns the key's pre-split segments.
+         */
+        detail::json_path::SplitKey split() const noexcept
+        {
+            return {parsed_->text, parsed_->segments};
+        }
+    };
+
   private:
+    friend class Txn;
+
     std::string file_path_;
     Path path_type_;
-    SaveStrategy save_strategy_;
-    MissingKeyPolicy missing_key_policy_;
+    std::atomic<SaveStrategy> save_strategy_;
+    std::atomic<MissingKeyPolicy> missing_key_policy_;
     JsonFormat json_format_ = JsonFormat::Pretty;
     StoreOptions opts_;
 
     mutable std::shared_mutex mutex_;
-    json data_;
-    std::unordered_map<std::string, Encoding> obfuscation_map_;
+    // Concurrency::Striped: per-section locks, taken while mutex_ is held shared (see WriteGuard).
+    detail::StripeLocks stripes_{0};
+    // Mutable so that readers can move StoreOptions::lazy_sections sections into it (see materialize()).
+    mutable detail::CowJson data_;
+    detail::ObfuscationMap obfuscation_map_;
+    // StoreOptions::lazy_sections: top-level sections of the file not parsed into data_ yet, guarded by
+    // mutex_.  A save shares it while writing; materialize_locked() copies it before taking sections out
+    // of a shared one.  lazy_pending_ mirrors lazy_ != nullptr so readers can skip the check without the lock.
+    mutable std::shared_ptr<detail::LazyDocument> lazy_;
+    mutable std::atomic<bool> lazy_pending_{false};
 
     struct Listener
     {
@@ -109,33 +261,237 @@ class ConfigStore
     std::atomic<bool> watch_active_{false};
     std::filesystem::file_time_type last_write_time_;
 
+    // Background writer state (SaveStrategy::Debounced and save_async()), guarded by flush_mutex_.
+    // The writer thread starts on first use; dirty_ is cleared just before a write, so a mutation
+    // racing the write marks the store dirty again and is picked up by the next one.
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cv_;
+    std::thread writer_thread_;
+    bool flush_stop_ = false;
+    bool dirty_      = false;
+    bool flushing_   = false; // a background or flush() write is in progress
+    std::chrono::steady_clock::time_point first_dirty_;
+    std::chrono::steady_clock::time_point last_dirty_;
+    // save_async() callers waiting on the next write; all of them share its result.
+    std::vector<std::promise<bool>> save_waiters_;
+    // Group commit: Auto-save requests are numbered, and each write records the last request
+    // whose changes its snapshot is certain to hold.
+    std::uint64_t save_requests_ = 0;
+    std::uint64_t saved_through_ = 0;
+    bool last_save_ok_           = true;
+    // Serializes save() so concurrent callers never write the file at the same time.
+    mutable std::mutex save_mutex_;
+    // Generation and format of the last successful save(), and the size and modification time of the
+    // file it wrote.  save() skips the write while all four still match.  Guarded by save_mutex_;
+    // saved_format_ is empty until the first save.
+    mutable std::optional<JsonFormat> saved_format_;
+    mutable std::uint64_t saved_generation_ = 0;
+    mutable std::uintmax_t saved_size_      = 0;
+    mutable std::filesystem::file_time_type saved_time_;
+
+    // StoreOptions::journal: operations recorded by the current writer, appended as one line by
+    // append_journal().  Guarded by mutex_.
+    json journal_ops_ = json::array();
+    mutable detail::Journal journal_;
+
     std::function<void(const json &)> validator_;
 
-    json defaults_;
+    detail::CowJson defaults_;
     std::unordered_map<std::string, std::string> env_bindings_;
 
+    // Bumped by every WriteGuard that modified data_ or defaults_.
+    std::atomic<std::uint64_t> generation_{0};
+    mutable detail::ConversionCache conversion_cache_;
+    mutable detail::PathIndex path_index_;
+    // Values kept current outside the lock (live() handles); expired entries are pruned on refresh.
+    std::vector<std::weak_ptr<detail::Mirror>> mirrors_;
+    detail::ScalarSlots scalar_slots_;
+    // Process-wide unique store id, never reused; ties register_scalar() keys to their slots.
+    const std::uint64_t id_ = next_id();
+    // StoreOptions::layered: the sources data_ is merged from.  data_ then also holds defaults_, and
+    // persisted_ holds the same merge without them, which is what save() writes.
+    detail::LayerStack layers_;
+    detail::CowJson persisted_;
+
     static constexpr const char *META_OBFUSCATION_KEY = "__obfuscate_meta__";
 
-    static void deep_merge(json &base, const json &overlay)
+    static std::uint64_t next_id() noexcept
+    {
+        static std::atomic<std::uint64_t> last{0};
+        return last.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Read access to data_ / defaults_: holds a shared lock in Concurrency::Locked
+    // mode and pins the published trees in Concurrency::Snapshot mode.  In
+    // Concurrency::Striped mode it also holds the stripes of the sections it may
+    // read: all of them, or only the key's when constructed for a single key.
+    // With StoreOptions::lazy_sections the sections it may read are parsed
+    // first; a view built from a stripe set leaves that to the caller.
+    class ReadView
     {
-        if (base.is_object() && overlay.is_object())
+        const ConfigStore &store_;
+        // Read before the tree is pinned so a view is never older than its generation.
+        std::uint64_t generation_;
+        std::shared_lock<std::shared_mutex> lock_;
+        detail::StripeLocks::Shared stripes_;
+        std::shared_ptr<const json> data_pin_;
+        mutable std::shared_ptr<const json> defaults_pin_;
+        const json *data_ = nullptr;
+
+        // Parses key's pending section, or every pending section for the root, trading the shared lock for the
+        // exclusive one meanwhile.
+        void settle(const std::string_view key)
         {
-            for (const auto &[key, val] : overlay.items())
+            while (store_.pending(key))
             {
-                if (base.contains(key) && base[key].is_object() && val.is_object())
-                {
-                    deep_merge(base[key], val);
-                }
-                else
-                {
-                    base[key] = val;
-                }
+                lock_.unlock();
+                store_.materialize(key);
+                lock_.lock();
+                data_ = &store_.data_.get();
             }
         }
-        else
+
+      public:
+        explicit ReadView(const ConfigStore &store) : ReadView(store, detail::StripeLocks::Set().set())
+        {
+            settle({});
+        }
+
+        // View for reading key and the keys beneath it.
+        ReadView(const ConfigStore &store, std::string_view key) : ReadView(store, store.stripes_.cover(key))
+        {
+            settle(key);
+        }
+
+        ReadView(const ConfigStore &store, const detail::StripeLocks::Set &stripes)
+            : store_(store), generation_(store.generation_.load(std::memory_order_acquire))
+        {
+            if (store.data_.publishing())
+            {
+                data_pin_ = store.data_.pin_published();
+                data_     = data_pin_.get();
+            }
+            else
+            {
+                lock_ = std::shared_lock(store.mutex_);
+                stripes_.lock(store.stripes_, stripes);
+                data_ = &store.data_.get();
+            }
+        }
+
+        const json &data() const noexcept
+        {
+            return *data_;
+        }
+
+        std::uint64_t generation() const noexcept
+        {
+            return generation_;
+        }
+
+        const json &defaults() const noexcept
+        {
+            if (!store_.defaults_.publishing())
+                return store_.defaults_.get();
+            if (!defaults_pin_)
+                defaults_pin_ = store_.defaults_.pin_published();
+            return *defaults_pin_;
+        }
+    };
+
+    // Exclusive access for writers.  Modified trees are published to
+    // Concurrency::Snapshot readers, and generation_ is bumped, before the lock
+    // is released.  A data_ change drops the path index unless the writer
+    // updated it in place and said so through index_maintained().
+    //
+    // In Concurrency::Striped mode a write of one key whose section already
+    // exists holds mutex_ shared and only its section's stripe exclusively, when
+    // section_writable() allows; such a sectioned() guard edits data_ in place
+    // (see data_for() and section_node()) and only bumps generation_.  Every
+    // other write, and every write that may add or remove a section, takes
+    // mutex_ exclusively.
+    class WriteGuard
+    {
+        ConfigStore &store_;
+        std::unique_lock<std::shared_mutex> lock_;
+        std::shared_lock<std::shared_mutex> shared_;
+        std::unique_lock<std::shared_mutex> stripe_;
+        // The one key a keyed guard writes; unless it runs through an array, mirrors overlapping it are all a
+        // change can reach (see refresh_mirrors()).  Views the caller's key, which outlives the guard.
+        std::optional<std::string_view> scope_;
+        bool index_maintained_ = false;
+        bool section_changed_  = false;
+
+      public:
+        explicit WriteGuard(ConfigStore &store) : store_(store), lock_(store.mutex_)
+        {
+        }
+        // Write of key alone with the given encoding.  erase marks a removal, which edits key's parent
+        // and so must lie below the section.
+        WriteGuard(ConfigStore &store, std::string_view key, const Encoding encoding, const bool erase = false)
+            : store_(store), scope_(key)
+        {
+            const auto stripe = encoding == Encoding::None ? store.stripes_.stripe_of(key, erase) : std::nullopt;
+            if (stripe)
+            {
+                shared_ = std::shared_lock(store.mutex_);
+                stripe_ = std::unique_lock(store.stripes_.at(*stripe));
+                if (store.section_writable(key))
+                    return;
+                stripe_.unlock();
+                shared_.unlock();
+            }
+            lock_ = std::unique_lock(store.mutex_);
+        }
+        ~WriteGuard()
+        {
+            if (sectioned())
+            {
+                if (section_changed_)
+                    store_.generation_.fetch_add(1, std::memory_order_release);
+                return;
+            }
+            const bool data_changed     = store_.data_.commit();
+            const bool defaults_changed = store_.defaults_.commit();
+            if (data_changed && !index_maintained_)
+                store_.path_index_.invalidate();
+            if (data_changed || defaults_changed)
+            {
+                store_.refresh_mirrors(scope_);
+                store_.generation_.fetch_add(1, std::memory_order_release);
+            }
+        }
+        void index_maintained() noexcept
+        {
+            index_maintained_ = true;
+        }
+        bool sectioned() const noexcept
+        {
+            return stripe_.owns_lock();
+        }
+        void section_changed() noexcept
         {
-            base = overlay;
+            section_changed_ = true;
         }
+        WriteGuard(const WriteGuard &)            = delete;
+        WriteGuard &operator=(const WriteGuard &) = delete;
+    };
+
+    // Republishes the live() values and scalar slots whose keys overlap scope, or all of them when scope is
+    // empty, from the current trees.  A scope that runs through an array may have moved its elements, which
+    // other keys name by index, so it refreshes them all too.  Caller holds mutex_ exclusively.
+    void refresh_mirrors(std::optional<std::string_view> scope = std::nullopt)
+    {
+        if (scope && (detail::json_path::through_array(data_.get(), *scope) ||
+                      detail::json_path::through_array(defaults_.get(), *scope)))
+            scope.reset();
+        scalar_slots_.refresh(data_.get(), defaults_.get(), scope);
+        std::erase_if(mirrors_, [&](const std::weak_ptr<detail::Mirror> &weak) {
+            const auto mirror = weak.lock();
+            if (mirror && (!scope || detail::json_path::overlaps(mirror->key(), *scope)))
+                mirror->refresh(data_.get(), defaults_.get());
+            return !mirror;
+        });
     }
 
     static void collect_keys(const json &node, const std::string &prefix, std::vector<std::string> &out)
@@ -155,7 +511,7 @@ class ConfigStore
         }
     }
 
-    void apply_single_env(const std::string &entry)
+    void apply_single_env(json &target, const std::string &entry)
     {
         const auto eq = entry.find('=');
         if (eq == std::string::npos)
@@ -187,14 +543,14 @@ class ConfigStore
         const std::string ptr_str = "/" + key;
         try
         {
-            data_[nlohmann::json::json_pointer(ptr_str)] = jval;
+            target[nlohmann::json::json_pointer(ptr_str)] = jval;
         }
         catch (...)
         {
         }
     }
 
-    void apply_single_env_binding(const std::string &key, const std::string &value)
+    void apply_single_env_binding(json &target, const std::string &key, const std::string &value)
     {
         nlohmann::json jval;
         try
@@ -208,14 +564,14 @@ class ConfigStore
         const std::string ptr_str = (!key.empty() && key.front() == '/') ? key : "/" + key;
         try
         {
-            data_[nlohmann::json::json_pointer(ptr_str)] = jval;
+            target[nlohmann::json::json_pointer(ptr_str)] = jval;
         }
         catch (...)
         {
         }
     }
 
-    void apply_env_overrides()
+    void apply_env_overrides(json &target)
     {
         if (!opts_.env_prefix.empty())
         {
@@ -224,86 +580,306 @@ class ConfigStore
             if (env)
             {
                 for (LPCH p = env; *p; p += strlen(p) + 1)
-                    apply_single_env(std::string(p));
+                    apply_single_env(target, std::string(p));
                 FreeEnvironmentStrings(env);
             }
 #else
             extern char **environ;
             for (char **ep = environ; *ep; ++ep)
-                apply_single_env(std::string(*ep));
+                apply_single_env(target, std::string(*ep));
 #endif
         }
         for (const auto &[key, env_var] : env_bindings_)
         {
             if (const char *val = std::getenv(env_var.c_str()))
-                apply_single_env_binding(key, val);
+                apply_single_env_binding(target, key, val);
         }
     }
 
-    void load()
+    // Parses file_path_ and replays the journal over it (StoreOptions::journal).
+    json read_file()
+    {
+        json loaded_data = read_base();
+        if (opts_.journal)
+            journal_.replay(loaded_data, obfuscation_map_.mut());
+        return loaded_data;
+    }
+
+    // Parses file_path_ and decodes its obfuscated values; a missing or unreadable file yields an empty object.
+    // Under lazy_loading() the file's top-level objects are left pending in lazy_ instead.
+    json read_base()
     {
         if (std::filesystem::exists(file_path_))
         {
             try
             {
-                std::ifstream file(file_path_);
+                std::shared_ptr<detail::LazyDocument> pending;
                 json loaded_data;
-                file >> loaded_data;
+                if (lazy_loading())
+                {
+                    auto text = std::make_shared<const std::string>(detail::FileIO::read_file(file_path_));
+                    pending   = detail::LazyDocument::scan(text, META_OBFUSCATION_KEY, loaded_data);
+                    if (!pending)
+                        loaded_data = detail::FileCodec::decode(*text, FileFormat::Json);
+                }
+                else
+                {
+                    loaded_data = detail::FileCodec::read(file_path_, opts_.file_format);
+                }
 
                 if (loaded_data.contains(META_OBFUSCATION_KEY))
                 {
                     auto meta = loaded_data[META_OBFUSCATION_KEY];
                     for (auto &[key, val] : meta.items())
                     {
-                        obfuscation_map_[key] = static_cast<Encoding>(val.get<int>());
+                        obfuscation_map_.mut()[key] = static_cast<Encoding>(val.get<int>());
                     }
                     loaded_data.erase(META_OBFUSCATION_KEY);
                 }
 
-                for (const auto &[key, type] : obfuscation_map_)
-                {
-                    if (type == Encoding::None)
-                        continue;
+                decrypt_values(loaded_data);
+                set_lazy(std::move(pending));
+                return loaded_data;
+            }
+            catch (...)
+            {
+            }
+        }
+        return json::object();
+    }
+
+    // Decodes the obfuscated values of root that the obfuscation map names.
+    void decrypt_values(json &root) const
+    {
+        for (const auto &[key, type] : obfuscation_map_.get())
+        {
+            if (type == Encoding::None)
+                continue;
 
-                    std::string ptr_str = (key.front() == '/') ? key : "/" + key;
-                    try
+            std::string ptr_str = (key.front() == '/') ? key : "/" + key;
+            try
+            {
+                nlohmann::json::json_pointer ptr(ptr_str);
+                if (root.contains(ptr))
+                {
+                    auto &val = root[ptr];
+                    if (val.is_string())
                     {
-                        nlohmann::json::json_pointer ptr(ptr_str);
-                        if (loaded_data.contains(ptr))
-                        {
-                            auto &val = loaded_data[ptr];
-                            if (val.is_string())
-                            {
-                                val = detail::ObfuscationEngine::decrypt(val.get<std::string>(), type);
-                            }
-                        }
+                        val = detail::ObfuscationEngine::decrypt(val.get<std::string>(), type);
                     }
-                    catch (...)
+                }
+            }
+            catch (...)
+            {
+                if (root.contains(key))
+                {
+                    auto &val = root[key];
+                    if (val.is_string())
                     {
-                        // std::cout << "Caught exception for key: " << key << std::endl;
-                        if (loaded_data.contains(key))
-                        {
-                            auto &val = loaded_data[key];
-                            if (val.is_string())
-                            {
-                                val = detail::ObfuscationEngine::decrypt(val.get<std::string>(), type);
-                            }
-                        }
+                        val = detail::ObfuscationEngine::decrypt(val.get<std::string>(), type);
                     }
                 }
-
-                data_ = loaded_data;
             }
-            catch (...)
+        }
+    }
+
+    // StoreOptions::lazy_sections holds for JSON text files of plain Locked stores.  A validator, live() mirror
+    // or scalar slot would need every section at once, so loads made while one is registered parse everything.
+    bool lazy_loading() const noexcept
+    {
+        return opts_.lazy_sections && opts_.concurrency == Concurrency::Locked &&
+               opts_.file_format == FileFormat::Json && !opts_.layered && !opts_.journal && !validator_ &&
+               mirrors_.empty() && scalar_slots_.empty();
+    }
+
+    void set_lazy(std::shared_ptr<detail::LazyDocument> document) const
+    {
+        if (document && document->empty())
+            document.reset();
+        lazy_pending_.store(document != nullptr, std::memory_order_release);
+        lazy_ = std::move(document);
+    }
+
+    // Top-level member name that key lies in, or "" for the root.
+    static std::string top_member(std::string_view key)
+    {
+        key = canonical_key(key);
+        std::string name;
+        detail::json_path::unescape(key.substr(0, key.find('/')), name);
+        return name;
+    }
+
+    // True if reading key needs a pending section parsed first: its own, or any for the root.  Caller holds mutex_.
+    bool pending(const std::string_view key) const
+    {
+        return lazy_pending_.load(std::memory_order_acquire) && lazy_ && lazy_->pending(top_member(key));
+    }
+
+    // Moves key's pending section (every pending section for the root) into data_.  Caller holds mutex_
+    // exclusively.
+    void materialize_locked(const std::string_view key) const
+    {
+        if (!lazy_)
+            return;
+        const std::string member = top_member(key);
+        if (!lazy_->pending(member))
+            return;
+        path_index_.invalidate();
+        if (lazy_.use_count() > 1)
+            lazy_ = std::make_shared<detail::LazyDocument>(*lazy_); // a save is still writing the old one
+        json &root         = data_.mut();
+        const auto extract = [&](const std::string &name) {
+            json section  = json::object();
+            section[name] = lazy_->take(name);
+            decrypt_values(section);
+            root[name] = std::move(section[name]);
+        };
+        if (member.empty())
+        {
+            while (!lazy_->empty())
+                extract(lazy_->sections().begin()->first);
+        }
+        else
+        {
+            extract(member);
+        }
+        set_lazy(std::move(lazy_));
+    }
+
+    // materialize_locked() for readers.  Parsing a section changes no value a reader can observe, so a
+    // const store may do it; the result is committed here rather than counted as a write.
+    void materialize(const std::string_view key) const
+    {
+        if (!lazy_pending_.load(std::memory_order_acquire))
+            return;
+        std::unique_lock lock(mutex_);
+        materialize_locked(key);
+        data_.commit();
+    }
+
+    void load()
+    {
+        set_lazy(nullptr);
+        if (opts_.layered)
+        {
+            layers_.file() = read_file();
+            layers_.env()  = json::object();
+            apply_env_overrides(layers_.env());
+            layers_.runtime() = json::object();
+            relayer_all();
+            return;
+        }
+        data_.reset(read_file());
+        if (lazy_)
+        {
+            // Overrides may land inside pending sections, which must be parsed before they are written to.
+            json env = json::object();
+            apply_env_overrides(env);
+            for (const auto &[name, value] : env.items())
             {
-                data_ = json::object();
+                std::string key;
+                detail::json_path::append_escaped(key, name);
+                materialize_locked(key);
             }
         }
+        apply_env_overrides(data_.mut());
+    }
+
+    // Layered mode: re-reads the file and environment layers and drops runtime sets,
+    // recomputing data_ only at the keys whose effective value may have changed.
+    void reload_layers(WriteGuard &guard)
+    {
+        json file = read_file();
+        json env  = json::object();
+        apply_env_overrides(env);
+
+        std::vector<std::string> changed;
+        std::string path;
+        detail::LayerStack::diff(layers_.file(), file, path, changed);
+        detail::LayerStack::diff(layers_.env(), env, path, changed);
+        detail::LayerStack::diff(layers_.runtime(), json::object(), path, changed);
+        layers_.file()    = std::move(file);
+        layers_.env()     = std::move(env);
+        layers_.runtime() = json::object();
+        for (const auto &key : changed)
+            relayer_at(guard, key);
+    }
+
+    // Shortest prefix of key naming a non-object in root; recomputing below it would write through a scalar or
+    // into an array that a higher layer replaces wholesale.
+    static std::string_view relayer_root(const json &root, std::string_view key)
+    {
+        key              = canonical_key(key);
+        const json *node = &root;
+        size_t begin     = 0;
+        size_t slash     = 0;
+        while ((slash = key.find('/', begin)) != std::string_view::npos)
+        {
+            node = detail::json_path::child(*node, key.substr(begin, slash - begin));
+            if (!node)
+                break;
+            if (!node->is_object())
+                return key.substr(0, slash);
+            begin = slash + 1;
+        }
+        return key;
+    }
+
+    // Layered mode: rebuilds data_ and persisted_ from every layer.
+    void relayer_all()
+    {
+        data_.reset(layers_.flatten(defaults_.get()));
+        persisted_.reset(layers_.flatten(json::object()));
+        path_index_.invalidate();
+    }
+
+    // Stores value at the non-empty canonical key of root, or erases the key when value is empty.
+    static void place(json &root, const std::string_view key, std::optional<json> value)
+    {
+        const nlohmann::json::json_pointer ptr("/" + std::string(key));
+        if (value)
+        {
+            root[ptr] = std::move(*value);
+        }
+        else if (detail::json_path::find_node(root, key))
+        {
+            json &parent = root[ptr.parent_pointer()];
+            if (parent.is_object())
+                parent.erase(ptr.back());
+        }
+    }
+
+    // Layered mode: recomputes the effective value of key in data_ from defaults_ and the layers, and in
+    // persisted_ from the layers alone, keeping the path index current.
+    void relayer_at(WriteGuard &guard, const std::string_view key)
+    {
+        json &saved                   = persisted_.mut();
+        const std::string_view outer = relayer_root(saved, key);
+        if (outer.empty())
+            persisted_.reset(layers_.flatten(json::object()));
         else
+            place(saved, outer, layers_.merged(json::object(), outer));
+
+        json &root                 = data_.mut();
+        const std::string_view top = relayer_root(root, key);
+        if (top.empty())
+        {
+            data_.reset(layers_.flatten(defaults_.get()));
+            path_index_.invalidate();
+            return;
+        }
+        const bool indexed = indexing() && path_index_.tracks(root);
+        if (indexed)
+        {
+            if (const json *old = detail::json_path::find_node(root, top))
+                path_index_.erase_subtree(top, *old);
+        }
+        place(root, top, layers_.merged(defaults_.get(), top));
+        if (indexed)
         {
-            data_ = json::object();
+            path_index_.insert_path(root, top);
+            guard.index_maintained();
         }
-        apply_env_overrides();
     }
 
     void notify(std::string_view key, const json &val) const
@@ -333,19 +909,49 @@ class ConfigStore
         }
     }
 
+    // Dispatches one transaction: a keyed listener fires once if any change touches its key, and a
+    // wildcard listener fires once with the whole change set ({key: new value}, null for removed keys).
+    void notify_batch(const std::vector<std::pair<std::string, json>> &changes) const
+    {
+        json change_set = json::object();
+        for (const auto &[key, value] : changes)
+            change_set[key] = value;
+        for (const auto &l : listeners_)
+        {
+            try
+            {
+                if (l.key.empty())
+                {
+                    l.callback(change_set);
+                    continue;
+                }
+                const bool touched = std::any_of(changes.begin(), changes.end(), [&l](const auto &change) {
+                    return change.first == l.key || change.first.find(l.key + "/") == 0;
+                });
+                if (touched)
+                {
+                    std::string ptr_str = (l.key.front() == '/') ? l.key : "/" + l.key;
+                    l.callback(get_value_at(ptr_str));
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+
     json get_value_at(std::string_view key_or_ptr) const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, key_or_ptr);
         // key_or_ptr is guaranteed to be non-empty by caller (notify) logic.
-        const std::string ptr_str =
-            (key_or_ptr.front() == '/') ? std::string(key_or_ptr) : "/" + std::string(key_or_ptr);
         json result;
         try
         {
 #if defined(CONFIG_TEST_FORCE_GET_VALUE_EXCEPTION)
             throw std::runtime_error("Forced exception");
 #endif
-            result = data_.at(nlohmann::json::json_pointer(ptr_str));
+            if (const json *node = detail::json_path::find_node(view.data(), key_or_ptr))
+                result = *node;
         }
         catch (...)
         {
@@ -354,75 +960,748 @@ class ConfigStore
         return result;
     }
 
-  public:
-    /**
-     * @brief Constructs a new ConfigStore instance.
-     *
-     * @param path File path for the configuration file.
-     * @param type Strategy for resolving the file path.
-     * @param save_strategy Strategy for saving changes (Auto or Manual).
-     * @param missing_key_policy Strategy for handling missing keys (DefaultValue or ThrowException).
-     */
-    ConfigStore(const std::string &path, const Path type = Path::Relative,
-                const SaveStrategy save_strategy          = SaveStrategy::Auto,
-                const MissingKeyPolicy missing_key_policy = MissingKeyPolicy::DefaultValue)
-        : path_type_(type), save_strategy_(save_strategy), missing_key_policy_(missing_key_policy)
+    // Key without its leading slash, as used by the path index and the conversion cache.
+    static std::string_view canonical_key(std::string_view key) noexcept
     {
-        file_path_ = detail::PathResolver::resolve(path, type);
-        load();
+        return key.starts_with('/') ? key.substr(1) : key;
+    }
+    static std::string_view canonical_key(const detail::json_path::SplitKey &key) noexcept
+    {
+        return canonical_key(key.text);
     }
 
-    /**
-     * @brief Constructs a new ConfigStore instance using a StoreOptions bundle.
-     *
-     * @param path File path for the configuration file.
-     * @param opts Options struct specifying path type, save strategy, missing key
-     *             policy, JSON format, and optional environment-variable prefix.
-     */
-    explicit ConfigStore(const std::string &path, StoreOptions opts)
-        : path_type_(opts.path_type), save_strategy_(opts.save), missing_key_policy_(opts.on_missing),
-          json_format_(opts.format), opts_(opts)
+    // Key as the caller wrote it, for diagnostics.
+    static std::string_view key_text(std::string_view key) noexcept
     {
-        file_path_ = detail::PathResolver::resolve(path, opts.path_type);
-        load();
+        return key;
+    }
+    static std::string_view key_text(const detail::json_path::SplitKey &key) noexcept
+    {
+        return key.text;
     }
 
-    ConfigStore(const ConfigStore &)            = delete;
-    ConfigStore &operator=(const ConfigStore &) = delete;
-    ConfigStore(ConfigStore &&)                 = delete;
-    ConfigStore &operator=(ConfigStore &&)      = delete;
+    // The path index is only consulted under the shared lock, i.e. in Concurrency::Locked mode.
+    // Striped section writers cannot keep it current, so it is off in Concurrency::Striped mode.
+    bool indexing() const noexcept
+    {
+        return opts_.index_paths && opts_.concurrency == Concurrency::Locked;
+    }
 
-    ~ConfigStore()
+    // Concurrency::Striped: true when a write of key may hold only its section's stripe (see WriteGuard).
+    // The section must already exist and nothing outside it may need updating: no layers, journal, encoding
+    // entry for key, live() mirrors, scalar slots, or pinned copy of data_.  Caller holds mutex_ shared and
+    // the stripe exclusively.
+    bool section_writable(std::string_view key) const
     {
-        stop_watch();
+        if (opts_.layered || journaling() || !mirrors_.empty() || !scalar_slots_.empty() || data_.shared() ||
+            (!obfuscation_map_.empty() && obfuscation_map_.get().contains(std::string(key))))
+        {
+            return false;
+        }
+        return detail::json_path::find_node(data_.get(), stripes_.section_of(key)) != nullptr;
     }
 
-    /**
-     * @brief Gets the absolute path to the configuration file.
-     * @return Absolute file path string.
-     */
-    std::string get_store_path() const
+    // data_ for a write under guard: edited in place by a sectioned() guard, copied on write otherwise.
+    json &data_for(WriteGuard &guard)
     {
-        return file_path_;
+        if (!guard.sectioned())
+            return data_.mut();
+        guard.section_changed();
+        return data_.unshared();
     }
 
-    /**
-     * @brief Gets the Path type used when constructing this store.
-     * @return The Path enum value (e.g., Relative, Absolute, AppData).
-     */
-    Path path_type() const
+    // Under a sectioned() guard: the node at key, which lies in its section, created if missing.  The section
+    // is reached with find() lookups only: writers of other sections walk the same ancestors concurrently,
+    // and std::map::operator[] may not be called alongside them.
+    json &section_node(WriteGuard &guard, const std::string_view key)
     {
-        return path_type_;
+        const std::string_view section = stripes_.section_of(key);
+        // section_writable() checked that the section exists.
+        json &node                   = *detail::json_path::find_node(data_for(guard), section);
+        const std::string_view below = canonical_key(key).substr(section.size());
+        return below.empty() ? node : node[nlohmann::json::json_pointer(std::string(below))];
     }
 
-    /**
-     * @brief Sets the strategy for saving configuration changes.
-     * @param strategy The new SaveStrategy (Auto or Manual).
-     */
-    void set_save_strategy(const SaveStrategy strategy)
+    // Finds key (a string or a pre-split key) in the view's data_ tree, probing the path index first when it is
+    // enabled.  Only the empty key names the root: "/" canonicalizes to "" too, but names the empty-named member.
+    template <typename K> const json *find_data(const ReadView &view, const K &key) const
     {
-        std::unique_lock lock(mutex_);
-        save_strategy_ = strategy;
+        const json &data = view.data();
+        if (indexing())
+            return key_text(key).empty() ? &data : path_index_.find(data, canonical_key(key));
+        return detail::json_path::find_node(data, key);
+    }
+
+    // Moves value to ptr in data_ (the runtime layer in layered mode), keeping the path index current
+    // when it describes the tree.
+    void assign_at(WriteGuard &guard, const nlohmann::json::json_pointer &ptr, std::string_view key, json &&value)
+    {
+        if (opts_.layered)
+        {
+            // The highest layer holding an array replaces it wholesale, so a write into an
+            // array element starts the runtime layer from the current effective array.
+            const std::string_view outer = relayer_root(data_.get(), key);
+            if (outer != canonical_key(key))
+            {
+                const json *node = detail::json_path::find_node(data_.get(), outer);
+                if (node->is_array())
+                    layers_.runtime()[nlohmann::json::json_pointer("/" + std::string(outer))] = *node;
+            }
+            layers_.runtime()[ptr] = std::move(value);
+            relayer_at(guard, key);
+            return;
+        }
+        if (guard.sectioned())
+        {
+            section_node(guard, key) = std::move(value);
+            return;
+        }
+        json &root         = data_for(guard);
+        const bool indexed = indexing() && path_index_.tracks(root);
+        if (indexed)
+        {
+            if (const json *old = detail::json_path::find_node(root, key))
+                path_index_.erase_subtree(canonical_key(key), *old);
+        }
+        root[ptr] = std::move(value);
+        if (indexed)
+        {
+            path_index_.insert_path(root, canonical_key(key));
+            guard.index_maintained();
+        }
+    }
+
+    // assign_at() plus the key's entry in the obfuscation map.
+    void write_at(WriteGuard &guard, const nlohmann::json::json_pointer &ptr, std::string_view key, json &&value,
+                  const Encoding encoding)
+    {
+        // The journal needs its own copy, but only once the write has succeeded.
+        std::optional<json> op;
+        if (journaling())
+            op = detail::Journal::add(ptr.to_string(), value, encoding, key);
+        assign_at(guard, ptr, key, std::move(value));
+        obfuscation_map_.assign(std::string(key), encoding);
+        if (op)
+            journal_ops_.push_back(std::move(*op));
+    }
+
+    // What notify() hands wildcard listeners for a written value: a copy when one is registered,
+    // otherwise null.  nullopt when nobody listens at all, so the caller can skip notify().
+    // Caller holds mutex_.
+    std::optional<json> listener_copy(const json &value) const
+    {
+        if (listeners_.empty())
+            return std::nullopt;
+        const bool wildcard =
+            std::any_of(listeners_.begin(), listeners_.end(), [](const Listener &l) { return l.key.empty(); });
+        return wildcard ? value : json();
+    }
+
+    // True when writing value at key would change nothing: the node the write would replace (in the
+    // runtime layer in layered mode) already equals value and has the same encoding.  Caller holds mutex_.
+    bool unchanged_at(std::string_view key, const json &value, const Encoding encoding)
+    {
+        const json *node = detail::json_path::find_node(opts_.layered ? layers_.runtime() : data_.get(), key);
+        if (!node || *node != value)
+            return false;
+        return obfuscation_map_.encoding(std::string(key)) == encoding;
+    }
+
+    // Removes key from data_ (every non-default layer in layered mode) along with its obfuscation-map entry.
+    // Returns false, touching neither the map nor the journal, if the key is missing or malformed.
+    bool erase_at(WriteGuard &guard, std::string_view key)
+    {
+        std::string ptr_str;
+        if (key.empty())
+        {
+            ptr_str = "/";
+        }
+        else
+        {
+            ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
+        }
+
+        try
+        {
+            const nlohmann::json::json_pointer ptr(ptr_str);
+
+            const auto parent_ptr = ptr.parent_pointer();
+            bool removed          = false;
+            if (opts_.layered)
+            {
+                removed = layers_.erase(canonical_key(key));
+                if (removed)
+                    relayer_at(guard, ptr_str);
+            }
+            else if (data_.get().contains(ptr) && guard.sectioned())
+            {
+                // The key lies strictly below its section (see WriteGuard), so its parent is inside it too.
+                section_node(guard, parent_ptr.to_string()).erase(ptr.back());
+                removed = true;
+            }
+            else if (data_.get().contains(ptr))
+            {
+                json &root         = data_for(guard);
+                const bool indexed = indexing() && path_index_.tracks(root);
+                if (indexed)
+                    path_index_.erase_subtree(canonical_key(key), root.at(ptr));
+                root[parent_ptr].erase(ptr.back());
+                if (indexed)
+                    guard.index_maintained();
+                removed = true;
+            }
+            if (!removed)
+                return false;
+            obfuscation_map_.assign(std::string(key), Encoding::None);
+            if (journaling())
+                journal_ops_.push_back(detail::Journal::remove(ptr_str, key));
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    // Resolves key against data_ and then the defaults_ layer.  A type mismatch
+    // in data_ falls through to defaults_; the error reports the last failure.
+    template <typename T, typename K> Expected<T> resolve(const ReadView &view, const K &key) const
+    {
+        Error error = Error::KeyNotFound;
+        if (const json *node = find_data(view, key))
+        {
+            if (auto value = detail::convert<T>(*node))
+                return value;
+            error = Error::TypeMismatch;
+        }
+        else if (opts_.layered)
+        {
+            return detail::fail(error); // data_ already holds the defaults layer
+        }
+        if (const json *node = detail::json_path::find_node(view.defaults(), key))
+        {
+            if (auto value = detail::convert<T>(*node))
+                return value;
+            error = Error::TypeMismatch;
+        }
+        return detail::fail(error);
+    }
+
+    // Like resolve(), but memoizes non-scalar conversions for the view's generation
+    // when StoreOptions::cache_conversions is set.
+    template <typename T, typename K> Expected<T> lookup(const ReadView &view, const K &key) const
+    {
+        if constexpr (!std::is_arithmetic_v<T> && !std::is_enum_v<T>)
+        {
+            if (opts_.cache_conversions)
+            {
+                const std::string_view canonical = canonical_key(key);
+                if (auto hit = conversion_cache_.find<T>(canonical, view.generation()))
+                    return *hit;
+                auto value = resolve<T>(view, key);
+                if (value)
+                    conversion_cache_.insert(canonical, view.generation(), std::make_shared<const T>(*value));
+                return value;
+            }
+        }
+        return resolve<T>(view, key);
+    }
+
+    // Reads a register_scalar() key from its seqlock slot; nullopt sends the caller down the regular path.
+    template <typename T> std::optional<T> read_slot(const Key<T> &key) const noexcept
+    {
+        if constexpr (detail::SlotScalar<T>)
+        {
+            T value{};
+            if (key.slot_ && key.owner_ == id_ && key.slot_->template read<T>(value))
+                return value;
+        }
+        return std::nullopt;
+    }
+
+    // Like lookup(), but applies missing_key_policy_ on a miss.
+    template <typename T, typename K>
+    T get_or_policy(const ReadView &view, const K &key, const std::source_location &location) const
+    {
+        if (auto value = lookup<T>(view, key))
+            return std::move(*value);
+        if (missing_key_policy_ == MissingKeyPolicy::ThrowException)
+        {
+            throw std::runtime_error(std::format("Key not found: {} ({}:{}:{})", key_text(key), location.file_name(),
+                                                 location.line(), location.function_name()));
+        }
+        return T{};
+    }
+
+    // Persists a mutation according to strategy: Auto saves before returning (see group_save()),
+    // Debounced hands the write to the writer thread, Manual does nothing.  A mutation already
+    // appended to the journal only reports that append's result.  Returns false only when an Auto
+    // save or journal append fails.
+    bool persist(const SaveStrategy strategy, const std::optional<bool> journaled = std::nullopt)
+    {
+        if (journaled)
+            return *journaled;
+        if (strategy == SaveStrategy::Auto)
+            return group_save();
+        if (strategy == SaveStrategy::Debounced)
+        {
+            std::lock_guard lock(flush_mutex_);
+            mark_dirty();
+            start_writer();
+        }
+        return true;
+    }
+
+    // True while the file still has the size and modification time the last save() left it with, so an
+    // external edit or removal makes the next save() rewrite it.  Caller holds save_mutex_.
+    bool saved_file_intact() const
+    {
+        std::error_code ec;
+        if (std::filesystem::file_size(file_path_, ec) != saved_size_ || ec)
+            return false;
+        return std::filesystem::last_write_time(file_path_, ec) == saved_time_ && !ec;
+    }
+
+    // True when Auto save appends to the journal instead of rewriting the file.  Caller holds mutex_.
+    bool journaling() const noexcept
+    {
+        return opts_.journal && save_strategy_ == SaveStrategy::Auto;
+    }
+
+    // Appends the operations recorded since the last call as one journal line, and schedules a
+    // compaction on the writer thread once the journal outgrows journal_compact_bytes.  Returns
+    // nullopt when nothing was recorded.  Caller holds mutex_ exclusively.
+    std::optional<bool> append_journal()
+    {
+        if (journal_ops_.empty())
+            return std::nullopt;
+        const bool ok = journal_.append(journal_ops_, opts_.durability != Durability::None);
+        journal_ops_.clear();
+        if (ok && journal_.size() >= opts_.journal_compact_bytes)
+        {
+            std::lock_guard lock(flush_mutex_);
+            mark_dirty();
+            start_writer();
+        }
+        return ok;
+    }
+
+    // Group commit for Auto save.  A caller arriving while a write is in flight waits for the next
+    // one, which starts after the caller's change and so includes it; one of the waiters performs
+    // that write for all of them.  Returns the result of the latest write covering the caller.
+    bool group_save()
+    {
+        std::unique_lock lock(flush_mutex_);
+        const std::uint64_t ticket = ++save_requests_;
+        flush_cv_.wait(lock, [&] { return saved_through_ >= ticket || !flushing_; });
+        if (saved_through_ >= ticket)
+            return last_save_ok_;
+        return write_pending(lock);
+    }
+
+    // Caller holds flush_mutex_.  Starts the writer thread if needed and wakes it.
+    void start_writer()
+    {
+        if (!writer_thread_.joinable() && !flush_stop_)
+            writer_thread_ = std::thread([this] { writer_loop(); });
+        flush_cv_.notify_all();
+    }
+
+    // Caller holds flush_mutex_.
+    void mark_dirty()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (!dirty_)
+            first_dirty_ = now;
+        dirty_      = true;
+        last_dirty_ = now;
+    }
+
+    // Serves save_async() requests as soon as no write is in progress.  Debounced changes are
+    // written once the store has been quiet for save_quiet_period or dirty for save_max_delay;
+    // a failed write is retried after another quiet period.
+    void writer_loop()
+    {
+        std::unique_lock lock(flush_mutex_);
+        while (true)
+        {
+            flush_cv_.wait(lock, [this] { return (write_wanted() && !flushing_) || flush_stop_; });
+            while (save_waiters_.empty() && dirty_ && !flush_stop_)
+            {
+                const auto deadline =
+                    std::min(last_dirty_ + opts_.save_quiet_period, first_dirty_ + opts_.save_max_delay);
+                if (std::chrono::steady_clock::now() >= deadline)
+                    break;
+                flush_cv_.wait_until(lock, deadline);
+            }
+            if (flush_stop_)
+                return;
+            if (write_wanted() && !flushing_)
+                (void)write_pending(lock);
+        }
+    }
+
+    // Caller holds flush_mutex_.
+    bool write_wanted() const noexcept
+    {
+        return dirty_ || !save_waiters_.empty();
+    }
+
+    // Saves with dirty_ cleared and flushing_ set, then hands the result to every save_async() and
+    // group_save() request made so far.  A failed write of debounced changes leaves the store dirty.
+    bool write_pending(std::unique_lock<std::mutex> &lock)
+    {
+        auto waiters                = std::move(save_waiters_);
+        const bool was_dirty        = dirty_;
+        const std::uint64_t covered = save_requests_;
+        save_waiters_.clear();
+        dirty_    = false;
+        flushing_ = true;
+        lock.unlock();
+        const bool ok = save();
+        lock.lock();
+        flushing_      = false;
+        saved_through_ = covered;
+        last_save_ok_  = ok;
+        if (!ok && was_dirty)
+            mark_dirty();
+        for (auto &waiter : waiters)
+            waiter.set_value(ok);
+        flush_cv_.notify_all();
+        return ok;
+    }
+
+    void set_at(const nlohmann::json::json_pointer &ptr, std::string_view key, json &&value, const Encoding encoding,
+                const std::source_location &location)
+    {
+        std::string error_msg;
+        std::optional<bool> journaled;
+        std::optional<json> notified;
+        {
+            WriteGuard guard(*this, key, encoding);
+            materialize_locked(key);
+            if (unchanged_at(key, value, encoding))
+                return;
+            try
+            {
+                notified = listener_copy(value);
+                write_at(guard, ptr, key, std::move(value), encoding);
+            }
+            catch (const std::exception &e)
+            {
+                error_msg = std::format("Config set failed for key '{}': {} ({}:{}:{})", key, e.what(),
+                                        location.file_name(), location.line(), location.function_name());
+            }
+            journaled = append_journal();
+        }
+
+        if (!error_msg.empty())
+        {
+            throw std::runtime_error(error_msg);
+        }
+
+        if (notified)
+            notify(key, *notified);
+
+        if (!persist(save_strategy_, journaled))
+        {
+            throw SaveError("Save failed for key '" + std::string(key) + "': disk write error");
+        }
+    }
+
+    // set() on a string key: "" replaces the root, anything else is parsed and handed to set_at().
+    void set_value(std::string_view key, json &&value, const Encoding encoding, const std::source_location &location)
+    {
+        if (key.empty())
+        {
+            std::string error_msg;
+            std::optional<bool> journaled;
+            {
+                const WriteGuard guard(*this);
+                try
+                {
+                    nlohmann::json new_root = std::move(value);
+                    if (!new_root.is_object())
+                    {
+                        throw std::invalid_argument("set(\"\") requires a JSON object type");
+                    }
+                    if (!opts_.layered && obfuscation_map_.empty() && !lazy_ && data_.get() == new_root)
+                        return;
+                    if (journaling())
+                        journal_ops_.push_back(detail::Journal::replace(new_root));
+                    if (opts_.layered)
+                    {
+                        layers_.clear();
+                        layers_.runtime() = std::move(new_root);
+                        relayer_all();
+                    }
+                    else
+                    {
+                        data_.reset(std::move(new_root));
+                    }
+                    set_lazy(nullptr);
+                    obfuscation_map_.clear();
+                }
+                catch (const std::invalid_argument &)
+                {
+                    throw;
+                }
+                catch (const std::exception &e)
+                {
+                    error_msg = std::format("Config set root failed: {} ({}:{}:{})", e.what(), location.file_name(),
+                                            location.line(), location.function_name());
+                }
+                journaled = append_journal();
+            }
+            if (!error_msg.empty())
+            {
+                throw std::runtime_error(error_msg);
+            }
+            if (!persist(save_strategy_, journaled))
+            {
+                throw SaveError("Save failed for key '': disk write error");
+            }
+            return;
+        }
+
+        nlohmann::json::json_pointer ptr;
+        try
+        {
+            ptr = nlohmann::json::json_pointer((key.front() == '/') ? std::string(key) : "/" + std::string(key));
+        }
+        catch (const std::exception &e)
+        {
+            throw std::runtime_error(std::format("Config set failed for key '{}': {} ({}:{}:{})", key, e.what(),
+                                                 location.file_name(), location.line(), location.function_name()));
+        }
+        set_at(ptr, key, std::move(value), encoding, location);
+    }
+
+    template <typename T>
+    T get_or_set_at(const nlohmann::json::json_pointer &ptr, std::string_view key, const T &default_value)
+    {
+        std::optional<bool> journaled;
+        std::optional<json> notified;
+        {
+            WriteGuard guard(*this, key, Encoding::None);
+            materialize_locked(key);
+            const json *node = detail::json_path::find_node(data_.get(), key);
+            // data_ includes the defaults in layered mode; a key only they hold is written as in flat mode.
+            if (node && opts_.layered && !key.empty() &&
+                layers_.source(defaults_.get(), key) == detail::LayerStack::defaults_name)
+                node = nullptr;
+            if (node)
+            {
+                if (auto value = detail::convert<T>(*node))
+                    return std::move(*value);
+            }
+            json value(default_value);
+            notified = listener_copy(value);
+            std::optional<json> op;
+            if (journaling())
+                op = detail::Journal::add(ptr.to_string(), value, Encoding::None);
+            assign_at(guard, ptr, key, std::move(value));
+            if (op)
+                journal_ops_.push_back(std::move(*op));
+            journaled = append_journal();
+        }
+
+        if (notified)
+            notify(key, *notified);
+
+        if (!persist(save_strategy_, journaled))
+            throw SaveError("get_or_set: auto-save failed for key '" + std::string(key) + "'");
+        return default_value;
+    }
+
+    // Read-modify-write of one key under a single exclusive lock.  mutate(node, found) edits a copy of the
+    // current value (from defaults_ when data_ lacks the key, null when neither has it), which is then moved
+    // back with the key's existing encoding.  An exception from mutate leaves the store untouched.
+    template <typename F>
+    void update_at(const nlohmann::json::json_pointer &ptr, std::string_view key, F &&mutate,
+                   const std::source_location &location)
+    {
+        std::optional<bool> journaled;
+        std::optional<json> notified;
+        {
+            // A key with an encoding is never written by a sectioned() guard; see section_writable().
+            WriteGuard guard(*this, key, Encoding::None);
+            materialize_locked(key);
+            const json *current = detail::json_path::find_node(data_.get(), key);
+            if (!current && !opts_.layered)
+                current = detail::json_path::find_node(defaults_.get(), key);
+            json value = current ? *current : json();
+            mutate(value, current != nullptr);
+
+            const Encoding encoding = obfuscation_map_.encoding(std::string(key));
+            if (unchanged_at(key, value, encoding))
+                return;
+            try
+            {
+                notified = listener_copy(value);
+                write_at(guard, ptr, key, std::move(value), encoding);
+            }
+            catch (const std::exception &e)
+            {
+                throw std::runtime_error(std::format("Config update failed for key '{}': {} ({}:{}:{})", key,
+                                                     e.what(), location.file_name(), location.line(),
+                                                     location.function_name()));
+            }
+            journaled = append_journal();
+        }
+
+        if (notified)
+            notify(key, *notified);
+
+        if (!persist(save_strategy_, journaled))
+            throw SaveError("update: auto-save failed for key '" + std::string(key) + "'");
+    }
+
+    // Pointer for a non-empty string key; caller names itself in the error.
+    static nlohmann::json::json_pointer key_pointer(std::string_view key, const char *caller)
+    {
+        if (key.empty())
+            throw std::invalid_argument(std::string(caller) + " requires a non-empty key");
+        return nlohmann::json::json_pointer((key.front() == '/') ? std::string(key) : "/" + std::string(key));
+    }
+
+    template <typename T, typename F>
+    T update_value(const nlohmann::json::json_pointer &ptr, std::string_view key, F &fn,
+                   const std::source_location &location)
+    {
+        T result{};
+        update_at(
+            ptr, key,
+            [&](json &node, const bool found) {
+                T value{};
+                if (found)
+                {
+                    auto converted = detail::convert<T>(node);
+                    if (!converted)
+                    {
+                        throw std::runtime_error(
+                            std::format("Config update failed for key '{}': type mismatch ({}:{}:{})", key,
+                                        location.file_name(), location.line(), location.function_name()));
+                    }
+                    value = std::move(*converted);
+                }
+                fn(value);
+                node   = value;
+                result = std::move(value);
+            },
+            location);
+        return result;
+    }
+
+  public:
+    /**
+     * @brief Constructs a new ConfigStore instance.
+     *
+     * @param path File path for the configuration file.
+     * @param type Strategy for resolving the file path.
+     * @param save_strategy Strategy for saving changes (Auto or Manual).
+     * @param missing_key_policy Strategy for handling missing keys (DefaultValue or ThrowException).
+     */
+    ConfigStore(const std::string &path, const Path type = Path::Relative,
+                const SaveStrategy save_strategy          = SaveStrategy::Auto,
+                const MissingKeyPolicy missing_key_policy = MissingKeyPolicy::DefaultValue)
+        : path_type_(type), save_strategy_(save_strategy), missing_key_policy_(missing_key_policy)
+    {
+        file_path_ = detail::PathResolver::resolve(path, type);
+        load();
+    }
+
+    /**
+     * @brief Constructs a new ConfigStore instance using a StoreOptions bundle.
+     *
+     * @param path File path for the configuration file.
+     * @param opts Options struct specifying path type, save strategy, missing key
+     *             policy, JSON format, optional environment-variable prefix, and
+     *             reader concurrency mode.
+     */
+    explicit ConfigStore(const std::string &path, StoreOptions opts)
+        : path_type_(opts.path_type), save_strategy_(opts.save), missing_key_policy_(opts.on_missing),
+          json_format_(opts.format), opts_(opts),
+          stripes_(opts.concurrency == Concurrency::Striped ? std::max<size_t>(opts.stripe_depth, 1) : 0),
+          data_(opts.concurrency == Concurrency::Snapshot),
+          defaults_(opts.concurrency == Concurrency::Snapshot)
+    {
+        file_path_ = detail::PathResolver::resolve(path, opts.path_type);
+        journal_.attach(file_path_);
+        load();
+        data_.commit();
+    }
+
+    ConfigStore(const ConfigStore &)            = delete;
+    ConfigStore &operator=(const ConfigStore &) = delete;
+    ConfigStore(ConfigStore &&)                 = delete;
+    ConfigStore &operator=(ConfigStore &&)      = delete;
+
+    ~ConfigStore()
+    {
+        stop_watch();
+        {
+            std::lock_guard lock(flush_mutex_);
+            flush_stop_ = true;
+        }
+        flush_cv_.notify_all();
+        if (writer_thread_.joinable())
+            writer_thread_.join();
+        (void)flush();
+    }
+
+    /**
+     * @brief Gets the absolute path to the configuration file.
+     * @return Absolute file path string.
+     */
+    std::string get_store_path() const
+    {
+        return file_path_;
+    }
+
+    /**
+     * @brief Gets the Path type used when constructing this store.
+     * @return The Path enum value (e.g., Relative, Absolute, AppData).
+     */
+    Path path_type() const
+    {
+        return path_type_;
+    }
+
+    /**
+     * @brief Sets the strategy for saving configuration changes.
+     *
+     * Changes still pending from SaveStrategy::Debounced are written before
+     * this returns.
+     *
+     * @param strategy The new SaveStrategy (Auto, Manual or Debounced).
+     */
+    void set_save_strategy(const SaveStrategy strategy)
+    {
+        {
+            std::unique_lock lock(mutex_);
+            save_strategy_ = strategy;
+        }
+        if (strategy != SaveStrategy::Debounced)
+            (void)flush();
+    }
+
+    /**
+     * @brief Writes changes still pending from SaveStrategy::Debounced to disk.
+     *
+     * Waits for a background write already in progress, then saves if any
+     * mutation has not been written yet or a save_async() request is queued.
+     * Does nothing when nothing is pending, whatever the save strategy.
+     *
+     * @return true if nothing was pending or the write succeeded.
+     */
+    [[nodiscard]] bool flush()
+    {
+        std::unique_lock lock(flush_mutex_);
+        flush_cv_.wait(lock, [this] { return !flushing_; });
+        if (!write_wanted())
+            return true;
+        return write_pending(lock);
     }
 
     /**
@@ -511,12 +1790,12 @@ class ConfigStore
         requires JsonReadable<T>
     T get(std::string_view key, const T &default_value) const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, key);
         if (key.empty())
         {
             try
             {
-                return data_.get<T>();
+                return view.data().get<T>();
             }
             catch (const nlohmann::json::exception &)
             {
@@ -524,29 +1803,46 @@ class ConfigStore
             }
         }
 
-        const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-        const nlohmann::json::json_pointer ptr(ptr_str);
-        if (data_.contains(ptr))
-        {
-            try
-            {
-                return data_.at(ptr).get<T>();
-            }
-            catch (...)
-            {
-                // Fallthrough to check defaults_ layer
-            }
-        }
-        if (defaults_.contains(ptr))
-        {
-            try
-            {
-                return defaults_.at(ptr).get<T>();
-            }
-            catch (...)
-            {
-            }
-        }
+        if (auto value = lookup<T>(view, key))
+            return std::move(*value);
+        return default_value;
+    }
+
+    /**
+     * @brief Retrieves a value through a pre-parsed key with a default fallback.
+     *
+     * @tparam T Type of the value to retrieve.
+     * @param key Handle returned by compile_key().
+     * @param default_value The value to return if the key is not found.
+     * @return The retrieved value or default_value.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    T get(const Key<T> &key, const std::type_identity_t<T> &default_value) const
+    {
+        if (auto value = read_slot(key))
+            return *value;
+        const ReadView view(*this, key.str());
+        if (auto value = lookup<T>(view, key.split()))
+            return std::move(*value);
+        return default_value;
+    }
+
+    /**
+     * @brief Retrieves a value through a compile-time key with a default fallback.
+     *
+     * @tparam T Type of the value to retrieve.
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @param default_value The value to return if the key is not found.
+     * @return The retrieved value or default_value.
+     */
+    template <typename T, detail::FixedString S>
+        requires JsonReadable<T>
+    T get(const StaticKey<S> &key, const T &default_value) const
+    {
+        const ReadView view(*this, key.str());
+        if (auto value = lookup<T>(view, key.split()))
+            return std::move(*value);
         return default_value;
     }
 
@@ -570,12 +1866,12 @@ class ConfigStore
         requires JsonReadable<T>
     T get(std::string_view key, const std::source_location location = std::source_location::current()) const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, key);
         if (key.empty())
         {
             try
             {
-                return data_.get<T>();
+                return view.data().get<T>();
             }
             catch (const nlohmann::json::exception &e)
             {
@@ -589,37 +1885,148 @@ class ConfigStore
             }
         }
 
-        const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-        const nlohmann::json::json_pointer ptr(ptr_str);
-        if (data_.contains(ptr))
-        {
-            try
-            {
-                return data_.at(ptr).get<T>();
-            }
-            catch (...)
-            {
-                // Type mismatch: treat as missing key / default value case
-            }
-        }
+        return get_or_policy<T>(view, key, location);
+    }
 
-        if (defaults_.contains(ptr))
-        {
-            try
-            {
-                return defaults_.at(ptr).get<T>();
-            }
-            catch (...)
-            {
-            }
-        }
+    /**
+     * @brief Retrieves a value through a pre-parsed key.
+     *
+     * Same missing-key behavior as get(std::string_view, std::source_location),
+     * without building or parsing a JSON Pointer on each call.
+     *
+     * @tparam T Type to deserialize into.
+     * @param key Handle returned by compile_key().
+     * @param location Source location for diagnostics.
+     * @return The retrieved value, or T{} on failure with DefaultValue strategy.
+     * @throws std::runtime_error If the key is missing with ThrowException strategy.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    T get(const Key<T> &key, const std::source_location location = std::source_location::current()) const
+    {
+        if (auto value = read_slot(key))
+            return *value;
+        const ReadView view(*this, key.str());
+        return get_or_policy<T>(view, key.split(), location);
+    }
 
-        if (missing_key_policy_ == MissingKeyPolicy::ThrowException)
+    /**
+     * @brief Retrieves a value through a compile-time key, walking its pre-split segments.
+     *
+     * @tparam T Type to deserialize into.
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @param location Source location for diagnostics.
+     * @return The retrieved value, or T{} on failure with DefaultValue strategy.
+     * @throws std::runtime_error If the key is missing with ThrowException strategy.
+     */
+    template <typename T, detail::FixedString S>
+        requires JsonReadable<T>
+    T get(const StaticKey<S> &key, const std::source_location location = std::source_location::current()) const
+    {
+        const ReadView view(*this, key.str());
+        return get_or_policy<T>(view, key.split(), location);
+    }
+
+    /**
+     * @brief Retrieves several values from one consistent view of the store.
+     *
+     * All keys are resolved under a single shared lock (or a single pinned
+     * snapshot in Concurrency::Snapshot mode, or one hold of every key's
+     * section in Concurrency::Striped mode), so no write can land between
+     * them.  Missing keys follow the MissingKeyPolicy, as with get(Key).
+     *
+     * @tparam Ts Value types of the keys.
+     * @param keys Handles returned by compile_key().
+     * @return Tuple of the values, in argument order.
+     * @throws std::runtime_error If a key is missing with ThrowException strategy.
+     */
+    template <typename... Ts>
+        requires(JsonReadable<Ts> && ...)
+    [[nodiscard]] std::tuple<Ts...> get_many(const Key<Ts> &...keys) const
+    {
+        (materialize(keys.str()), ...);
+        const ReadView view(*this, (detail::StripeLocks::Set() | ... | stripes_.cover(keys.str())));
+        const auto location = std::source_location::current();
+        return std::tuple<Ts...>{get_or_policy<Ts>(view, keys.split(), location)...};
+    }
+
+    /**
+     * @brief Retrieves a run of same-typed values from one consistent view of the store.
+     *
+     * Dynamic counterpart of the variadic get_many() for key lists built at run time.
+     *
+     * @tparam T Value type of the keys.
+     * @param keys Handles returned by compile_key().
+     * @return Values in the order of @p keys.
+     * @throws std::runtime_error If a key is missing with ThrowException strategy.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] std::vector<T> get_many(std::span<const Key<T>> keys) const
+    {
+        std::vector<T> result;
+        result.reserve(keys.size());
+        detail::StripeLocks::Set stripes;
+        for (const auto &key : keys)
         {
-            throw std::runtime_error(std::format("Key not found: {} ({}:{}:{})", key, location.file_name(),
-                                                 location.line(), location.function_name()));
+            materialize(key.str());
+            stripes |= stripes_.cover(key.str());
         }
-        return T{};
+        const ReadView view(*this, stripes);
+        const auto location = std::source_location::current();
+        for (const auto &key : keys)
+            result.push_back(get_or_policy<T>(view, key.split(), location));
+        return result;
+    }
+
+    /**
+     * @brief Retrieves a value without throwing.
+     *
+     * Resolves like get(): data first, then the defaults layer.  The
+     * MissingKeyPolicy is ignored.  A missing key is reported without throwing,
+     * formatting, or allocating, and scalar and string type mismatches are
+     * detected with type checks rather than exceptions.
+     *
+     * @tparam T Type to deserialize into.
+     * @param key The configuration key / JSON Pointer path, or "" for the root object.
+     * @return The value, Error::KeyNotFound, or Error::TypeMismatch.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] Expected<T> try_get(std::string_view key) const
+    {
+        const ReadView view(*this, key);
+        if (key.empty())
+            return detail::convert<T>(view.data());
+        return lookup<T>(view, key);
+    }
+
+    /**
+     * @brief Retrieves a value through a pre-parsed key without throwing.
+     * @param key Handle returned by compile_key() or register_scalar().
+     * @return The value, Error::KeyNotFound, or Error::TypeMismatch.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] Expected<T> try_get(const Key<T> &key) const
+    {
+        if (auto value = read_slot(key))
+            return *value;
+        const ReadView view(*this, key.str());
+        return lookup<T>(view, key.split());
+    }
+
+    /**
+     * @brief Retrieves a value through a compile-time key without throwing.
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @return The value, Error::KeyNotFound, or Error::TypeMismatch.
+     */
+    template <typename T, detail::FixedString S>
+        requires JsonReadable<T>
+    [[nodiscard]] Expected<T> try_get(const StaticKey<S> &key) const
+    {
+        const ReadView view(*this, key.str());
+        return lookup<T>(view, key.split());
     }
 
     /**
@@ -629,93 +2036,220 @@ class ConfigStore
      * @param key The configuration key or JSON Pointer path.
      * @param value The value to store.
      * @param encoding Encoding method to apply (optional).
-     * @param location
-     * @throws std::invalid_argument If key is "" and value is not a JSON object type.
+     * @param location
+     * @throws std::invalid_argument If key is "" and value is not a JSON object type.
+     * @throws std::runtime_error If setting the value fails in memory (e.g., path conflict).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T>
+        requires JsonWritable<T>
+    void set(std::string_view key, const T &value, const Encoding encoding = Encoding::None,
+             const std::source_location location = std::source_location::current())
+    {
+        set_value(key, json(value), encoding, location);
+    }
+
+    /**
+     * @brief Sets a value, moving it into the store.
+     *
+     * Rvalue overload of set(): the value is converted to JSON once and the
+     * result is moved into the tree, so strings and json values are not
+     * copied.  Listeners are notified without a further conversion.
+     *
+     * @tparam T Type of the value to set.
+     * @param key The configuration key or JSON Pointer path.
+     * @param value The value to store; left in a moved-from state.
+     * @param encoding Encoding method to apply (optional).
+     * @param location Source location for diagnostics.
+     * @throws std::invalid_argument If key is "" and value is not a JSON object type.
+     * @throws std::runtime_error If setting the value fails in memory (e.g., path conflict).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T>
+        requires JsonWritable<T> && (!std::is_reference_v<T>)
+    void set(std::string_view key, T &&value, const Encoding encoding = Encoding::None,
+             const std::source_location location = std::source_location::current())
+    {
+        set_value(key, json(std::move(value)), encoding, location);
+    }
+
+    /**
+     * @brief Sets a JSON value, moving it into the store.
+     *
+     * Pass an rvalue (e.g. std::move(tree)) to store a large object or array
+     * without copying any node; an lvalue is copied once.
+     *
+     * @param key The configuration key or JSON Pointer path.
+     * @param value The value to store.
+     * @param encoding Encoding method to apply (optional).
+     * @param location Source location for diagnostics.
+     * @throws std::invalid_argument If key is "" and value is not a JSON object.
+     * @throws std::runtime_error If setting the value fails in memory (e.g., path conflict).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    void set_json(std::string_view key, json value, const Encoding encoding = Encoding::None,
+                  const std::source_location location = std::source_location::current())
+    {
+        set_value(key, std::move(value), encoding, location);
+    }
+
+    /**
+     * @brief Sets a value through a pre-parsed key.
+     *
+     * @tparam T Type of the value to set.
+     * @param key Handle returned by compile_key().
+     * @param value The value to store.
+     * @param encoding Encoding method to apply (optional).
+     * @param location Source location for diagnostics.
+     * @throws std::runtime_error If setting the value fails in memory (e.g., path conflict).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T>
+        requires JsonWritable<T>
+    void set(const Key<T> &key, const std::type_identity_t<T> &value, const Encoding encoding = Encoding::None,
+             const std::source_location location = std::source_location::current())
+    {
+        set_at(key.pointer(), key.str(), json(value), encoding, location);
+    }
+
+    /**
+     * @brief Sets a value through a pre-parsed key, moving it into the store.
+     * @see set(std::string_view, T &&, Encoding, std::source_location)
+     */
+    template <typename T>
+        requires JsonWritable<T>
+    void set(const Key<T> &key, std::type_identity_t<T> &&value, const Encoding encoding = Encoding::None,
+             const std::source_location location = std::source_location::current())
+    {
+        set_at(key.pointer(), key.str(), json(std::move(value)), encoding, location);
+    }
+
+    /**
+     * @brief Sets a value through a compile-time key.
+     *
+     * @tparam T Type of the value to set.
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @param value The value to store.
+     * @param encoding Encoding method to apply (optional).
+     * @param location Source location for diagnostics.
      * @throws std::runtime_error If setting the value fails in memory (e.g., path conflict).
      * @throws SaveError If auto-save is enabled and the disk write fails.
      */
-    template <typename T>
+    template <typename T, detail::FixedString S>
         requires JsonWritable<T>
-    void set(std::string_view key, const T &value, const Encoding encoding = Encoding::None,
+    void set(const StaticKey<S> &key, const T &value, const Encoding encoding = Encoding::None,
              const std::source_location location = std::source_location::current())
     {
-        if (key.empty())
-        {
-            std::string error_msg;
-            {
-                std::unique_lock lock(mutex_);
-                try
-                {
-                    nlohmann::json new_root = nlohmann::json(value);
-                    if (!new_root.is_object())
-                    {
-                        throw std::invalid_argument("set(\"\") requires a JSON object type");
-                    }
-                    data_ = std::move(new_root);
-                    obfuscation_map_.clear();
-                }
-                catch (const std::invalid_argument &)
-                {
-                    throw;
-                }
-                catch (const std::exception &e)
-                {
-                    error_msg = std::format("Config set root failed: {} ({}:{}:{})", e.what(), location.file_name(),
-                                            location.line(), location.function_name());
-                }
-            }
-            if (!error_msg.empty())
-            {
-                throw std::runtime_error(error_msg);
-            }
-            if (save_strategy_ == SaveStrategy::Auto)
-            {
-                if (!save())
-                {
-                    throw SaveError("Save failed for key '': disk write error");
-                }
-            }
-            return;
-        }
+        set_at(key.pointer(), key.str(), json(value), encoding, location);
+    }
 
-        std::string error_msg;
-        {
-            std::unique_lock lock(mutex_);
-            const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-            try
-            {
-                data_[nlohmann::json::json_pointer(ptr_str)] = value;
+    /**
+     * @brief Sets a value through a compile-time key, moving it into the store.
+     * @see set(std::string_view, T &&, Encoding, std::source_location)
+     */
+    template <typename T, detail::FixedString S>
+        requires JsonWritable<T> && (!std::is_reference_v<T>)
+    void set(const StaticKey<S> &key, T &&value, const Encoding encoding = Encoding::None,
+             const std::source_location location = std::source_location::current())
+    {
+        set_at(key.pointer(), key.str(), json(std::move(value)), encoding, location);
+    }
 
-                if (encoding != Encoding::None)
-                {
-                    obfuscation_map_[std::string(key)] = encoding;
-                }
-                else
-                {
-                    obfuscation_map_.erase(std::string(key));
-                }
-            }
-            catch (const std::exception &e)
-            {
-                error_msg = std::format("Config set failed for key '{}': {} ({}:{}:{})", key, e.what(),
-                                        location.file_name(), location.line(), location.function_name());
-            }
-        }
+    /**
+     * @brief Parses a key once into a reusable handle.
+     *
+     * Pass the returned Key to the get/set/contains/get_or_set overloads on hot
+     * paths that access the same key repeatedly.
+     *
+     * @tparam T Value type the key is read and written as.
+     * @param key Non-empty configuration key or JSON Pointer path.
+     * @return Pre-parsed key handle.
+     * @throws std::invalid_argument If key is empty or not a valid JSON Pointer.
+     */
+    template <typename T> [[nodiscard]] Key<T> compile_key(std::string_view key) const
+    {
+        return Key<T>(key);
+    }
 
-        if (!error_msg.empty())
-        {
-            throw std::runtime_error(error_msg);
-        }
+    /**
+     * @brief Registers a scalar key for lock-free reads through a sequence-locked slot.
+     *
+     * The store mirrors the key's value into a cache-line-aligned slot and
+     * republishes it in the same critical section as every write that changes
+     * the data or the defaults.  get() on the returned Key then reads the slot
+     * with a few atomic loads instead of locking the store; a missing or
+     * non-convertible key falls back to the regular path, so defaults and the
+     * MissingKeyPolicy behave exactly as with any other Key.
+     *
+     * A write of one key refreshes only the slots whose keys name it, a node
+     * above it, or a node below it; one that runs through an array refreshes
+     * every slot, since it may shift the indices other keys name.  Every other
+     * write (merge, clear, set_default, reload, transactions, ...) also
+     * refreshes every slot, so register only the keys read on hot paths.
+     *
+     * Slots live as long as the store.  The returned Key may outlive it: the
+     * Key remembers the store by a unique id rather than its address, so with
+     * any other store, including one later allocated at the same address, it
+     * acts as a plain Key and never touches the freed slot.
+     *
+     * @tparam T bool, an integer type, or a floating-point type of at most 64 bits.
+     * @param key Non-empty configuration key or JSON Pointer path.
+     * @return Key bound to this store's slot; with other stores it acts as a plain Key.
+     * @throws std::invalid_argument If key is empty or not a valid JSON Pointer.
+     */
+    template <typename T>
+        requires detail::SlotScalar<T>
+    [[nodiscard]] Key<T> register_scalar(std::string_view key)
+    {
+        Key<T> handle(key);
+        std::unique_lock lock(mutex_);
+        materialize_locked(handle.str());
+        data_.commit();
+        handle.slot_  = scalar_slots_.add<T>(handle.str(), data_.get(), defaults_.get());
+        handle.owner_ = id_;
+        return handle;
+    }
 
-        notify(key, json(value));
+    /**
+     * @brief Returns a handle that always holds the current value of a key.
+     *
+     * The store republishes the value after every write that changes the data
+     * or the defaults (set, remove, clear, merge, reload, watcher reloads,
+     * set_default, ...), so Live::load() costs a single atomic load and never
+     * contends with writers.  Resolution matches get(key, default_value).
+     *
+     * @tparam T Type of the value.  Trivially copyable, lock-free types are
+     *           stored inline; other types are handed out as std::shared_ptr<const T>.
+     * @param key The configuration key or JSON Pointer path.
+     * @param default_value Value held while the key is missing or not convertible to T.
+     * @return Handle to the live value.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] Live<T> live(std::string_view key, T default_value = T{})
+    {
+        auto cell = std::make_shared<detail::LiveCell<T>>(std::string(key), std::move(default_value));
+        std::unique_lock lock(mutex_);
+        materialize_locked(key);
+        data_.commit();
+        cell->refresh(data_.get(), defaults_.get());
+        mirrors_.push_back(cell);
+        return Live<T>(std::move(cell));
+    }
 
-        if (save_strategy_ == SaveStrategy::Auto)
-        {
-            if (!save())
-            {
-                throw SaveError("Save failed for key '" + std::string(key) + "': disk write error");
-            }
-        }
+    /**
+     * @brief Returns counters for the path index enabled by StoreOptions::index_paths.
+     *
+     * The index is built on the first read after a bulk change (load, reload,
+     * merge, clear, ...) and updated in place by set, get_or_set, and remove.
+     * All counters stay zero when the index is disabled.
+     *
+     * @return Entry count and rebuild count since construction.
+     */
+    [[nodiscard]] IndexStats index_stats() const
+    {
+        std::shared_lock lock(mutex_);
+        return path_index_.stats();
     }
 
     /**
@@ -768,62 +2302,67 @@ class ConfigStore
 
     /**
      * @brief Removes a key and its value from the configuration.
+     *
+     * Removing a key that is not set changes nothing and saves nothing.
+     *
      * @param key The configuration key or JSON Pointer path to remove.
      * @throws SaveError If auto-save is enabled and the disk write fails.
      */
     void remove(std::string_view key)
     {
+        std::optional<bool> journaled;
+        bool removed = false;
         {
-            std::unique_lock lock(mutex_);
-            std::string ptr_str;
-            if (key.empty())
-            {
-                ptr_str = "/";
-            }
-            else
-            {
-                ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-            }
-
-            try
-            {
-                const nlohmann::json::json_pointer ptr(ptr_str);
-
-                const auto parent_ptr = ptr.parent_pointer();
-                if (data_.contains(parent_ptr))
-                {
-                    auto &parent = data_[parent_ptr];
-                    parent.erase(ptr.back());
-                }
-                obfuscation_map_.erase(std::string(key));
-            }
-            catch (...)
-            {
-            }
+            WriteGuard guard(*this, key, Encoding::None, true);
+            materialize_locked(key);
+            removed   = erase_at(guard, key);
+            journaled = append_journal();
         }
-        if (save_strategy_ == SaveStrategy::Auto)
+        if (removed && !persist(save_strategy_, journaled))
         {
-            if (!save())
-            {
-                throw SaveError("Remove: disk write error");
-            }
+            throw SaveError("Remove: disk write error");
         }
     }
 
     /**
      * @brief Checks if a key exists in the configuration.
+     *
+     * Values registered with set_default() only count in a layered store,
+     * whose merged view includes the defaults layer (see StoreOptions::layered).
+     *
      * @param key The configuration key or JSON Pointer path.
      * @return true if the key exists, false otherwise.
      */
     [[nodiscard]] bool contains(std::string_view key) const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, key);
         if (key.empty())
         {
-            return !data_.empty();
+            return !view.data().empty();
         }
-        const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-        return data_.contains(nlohmann::json::json_pointer(ptr_str));
+        return find_data(view, key) != nullptr;
+    }
+
+    /**
+     * @brief Checks if a pre-parsed key exists in the configuration.
+     * @param key Handle returned by compile_key().
+     * @return true if the key exists, false otherwise.
+     */
+    template <typename T> [[nodiscard]] bool contains(const Key<T> &key) const
+    {
+        const ReadView view(*this, key.str());
+        return find_data(view, key.split()) != nullptr;
+    }
+
+    /**
+     * @brief Checks if a compile-time key exists in the configuration.
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @return true if the key exists, false otherwise.
+     */
+    template <detail::FixedString S> [[nodiscard]] bool contains(const StaticKey<S> &key) const
+    {
+        const ReadView view(*this, key.str());
+        return find_data(view, key.split()) != nullptr;
     }
 
     /**
@@ -835,21 +2374,58 @@ class ConfigStore
         return save(json_format_);
     }
 
+    /**
+     * @brief Saves the current configuration on the store's writer thread.
+     *
+     * Returns at once.  At most one write is in flight and one queued: every
+     * request made while a write is running joins the single queued write,
+     * which snapshots the store when it starts and so includes every change
+     * made before the request.
+     *
+     * @return Future receiving save()'s result for the write that served the request.
+     */
+    [[nodiscard]] std::future<bool> save_async()
+    {
+        std::lock_guard lock(flush_mutex_);
+        auto future = save_waiters_.emplace_back().get_future();
+        start_writer();
+        return future;
+    }
+
     /**
      * @brief Saves the current configuration to disk using a specific format.
-     * @param format The output format (Pretty or Compact).
+     * @param format The output format (Pretty or Compact); only used when StoreOptions::file_format is
+     *               FileFormat::Json.
      * @return true if saved successfully, false otherwise.
      */
     [[nodiscard]] bool save(JsonFormat format) const
     {
+        // Held across snapshot and write so the last caller to snapshot is the last to write.
+        std::lock_guard save_lock(save_mutex_);
+        if (saved_format_ == format && saved_generation_ == generation_.load(std::memory_order_acquire) &&
+            saved_file_intact())
+        {
+            return true;
+        }
         bool result = false;
-        json save_data;
-        std::unordered_map<std::string, Encoding> obf_map_copy;
+        std::shared_ptr<const json> snapshot;
+        std::shared_ptr<const detail::ObfuscationMap::Map> encodings;
+        std::shared_ptr<const detail::LazyDocument> unparsed;
+        std::uint64_t generation = 0;
 
         {
+            // Pinning shares the live trees instead of copying them: a writer that arrives before
+            // the pins are dropped copies the tree on its first change, and nobody else does.
+            // Holding every stripe keeps Concurrency::Striped section writers out meanwhile.
             std::shared_lock lock(mutex_);
-            save_data    = data_;
-            obf_map_copy = obfuscation_map_;
+            const detail::StripeLocks::Shared sections(stripes_);
+            generation = generation_.load(std::memory_order_relaxed);
+            snapshot   = opts_.layered ? persisted_.pin() : data_.pin();
+            encodings  = obfuscation_map_.pin();
+            unparsed   = lazy_;
+            // Records appended from here on are not in this snapshot and go to a fresh journal.
+            if (opts_.journal)
+                journal_.rotate();
         }
 
         try
@@ -859,58 +2435,50 @@ class ConfigStore
             {
                 std::filesystem::create_directories(p.parent_path());
             }
-
-            if (!obf_map_copy.empty())
+            if (opts_.file_format == FileFormat::Json)
             {
-                for (const auto &[key, type] : obf_map_copy)
-                {
-                    if (type == Encoding::None)
-                        continue;
-
-                    std::string ptr_str = (key.front() == '/') ? key : "/" + key;
-                    try
-                    {
-                        nlohmann::json::json_pointer ptr(ptr_str);
-                        if (save_data.contains(ptr))
-                        {
-                            auto &val = save_data[ptr];
-                            if (val.is_string())
-                            {
-                                val = detail::ObfuscationEngine::encrypt(val.get<std::string>(), type);
-                            }
-                        }
-                    }
-                    catch (...)
-                    {
-                    }
-                }
-
-                json meta;
-                for (const auto &[key, val] : obf_map_copy)
-                {
-                    meta[key] = static_cast<int>(val);
-                }
-                save_data[META_OBFUSCATION_KEY] = meta;
+                result = detail::FileIO::write_stream(file_path_, opts_.durability, [&](const auto &sink) {
+                    detail::JsonWriter writer(sink, format);
+                    return writer.write(*snapshot, *encodings, META_OBFUSCATION_KEY,
+                                        unparsed ? &unparsed->sections() : nullptr);
+                });
             }
-
-            std::ofstream file(file_path_);
-            if (file.is_open())
+            else
             {
-                if (format == JsonFormat::Pretty)
-                {
-                    file << save_data.dump(4);
-                }
-                else
-                {
-                    file << save_data.dump();
-                }
-                result = file.good();
+                const auto bytes =
+                    detail::FileCodec::encode(*snapshot, *encodings, META_OBFUSCATION_KEY, opts_.file_format);
+                result = detail::FileIO::write_file(
+                    file_path_, std::string_view(reinterpret_cast<const char *>(bytes.data()), bytes.size()),
+                    opts_.durability);
             }
         }
         catch (...)
         {
             result = false;
         }
+        {
+            // Released under the locks, so a writer's use_count() check never races with the drop.
+            std::shared_lock lock(mutex_);
+            const detail::StripeLocks::Shared sections(stripes_);
+            snapshot.reset();
+            encodings.reset();
+            unparsed.reset();
+        }
+        if (result && opts_.journal)
+            journal_.discard_rotated();
+        saved_format_.reset();
+        if (result)
+        {
+            std::error_code size_error;
+            std::error_code time_error;
+            saved_size_ = std::filesystem::file_size(file_path_, size_error);
+            saved_time_ = std::filesystem::last_write_time(file_path_, time_error);
+            if (!size_error && !time_error)
+            {
+                saved_format_     = format;
+                saved_generation_ = generation;
+            }
+        }
         return result;
     }
 
@@ -923,28 +2491,57 @@ class ConfigStore
      */
     void reload()
     {
-        json old_data;
-        json snapshot;
+        std::shared_ptr<const json> old_data;
+        std::shared_ptr<const json> old_persisted;
+        std::shared_ptr<detail::LazyDocument> old_lazy;
+        std::optional<detail::LayerStack> old_layers;
+        std::shared_ptr<const json> snapshot;
         std::function<void(const json &)> val;
         {
-            std::unique_lock lock(mutex_);
-            old_data = data_;
-            load();
-            snapshot = data_;
-            val      = validator_;
+            WriteGuard guard(*this);
+            val = validator_;
+            if (val)
+            {
+                old_data = data_.pin();
+                old_lazy = lazy_;
+                if (opts_.layered)
+                {
+                    old_persisted = persisted_.pin();
+                    old_layers    = layers_;
+                }
+            }
+            if (opts_.layered)
+                reload_layers(guard);
+            else
+                load();
+            if (val)
+                snapshot = data_.pin();
         }
         if (val)
         {
             try
             {
-                val(snapshot);
+                val(*snapshot);
             }
             catch (...)
             {
-                std::unique_lock lock(mutex_);
-                data_ = std::move(old_data);
+                const WriteGuard guard(*this);
+                data_.restore(std::move(old_data));
+                set_lazy(std::move(old_lazy));
+                if (old_layers)
+                {
+                    persisted_.restore(std::move(old_persisted));
+                    layers_ = std::move(*old_layers);
+                }
+                snapshot.reset();
                 throw;
             }
+            // Released under the locks, as in save().
+            std::shared_lock lock(mutex_);
+            const detail::StripeLocks::Shared sections(stripes_);
+            snapshot.reset();
+            old_data.reset();
+            old_persisted.reset();
         }
     }
 
@@ -956,20 +2553,50 @@ class ConfigStore
      */
     void clear()
     {
+        std::optional<bool> journaled;
         {
-            std::unique_lock lock(mutex_);
-            data_.clear();
+            const WriteGuard guard(*this);
+            if (opts_.layered)
+            {
+                layers_.clear();
+                relayer_all();
+            }
+            else
+            {
+                data_.reset(json::object());
+            }
+            set_lazy(nullptr);
             obfuscation_map_.clear();
+            if (journaling())
+                journal_ops_.push_back(detail::Journal::replace(json::object()));
+            journaled = append_journal();
         }
-        if (save_strategy_ == SaveStrategy::Auto)
+        if (!persist(save_strategy_, journaled))
         {
-            if (!save())
-            {
-                throw SaveError("Clear: disk write error");
-            }
+            throw SaveError("Clear: disk write error");
         }
     }
 
+    /**
+     * @brief Applies a batch of mutations atomically.
+     *
+     * @p fn receives a Txn and may call its set/remove/get/contains any number
+     * of times.  Everything runs under one exclusive lock, so other threads see
+     * either none or all of the changes.  If @p fn throws, every change is
+     * rolled back and the exception propagates.  On commit, listeners are
+     * dispatched once for the whole batch and, with SaveStrategy::Auto, the
+     * file is written once.
+     *
+     * @p fn must not call this store's own members: the exclusive lock is held
+     * for its whole duration, so doing so deadlocks.  Use the Txn instead.
+     *
+     * @param fn Callable invoked as fn(Txn &).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename Fn>
+        requires std::invocable<Fn &, Txn &>
+    void transaction(Fn &&fn);
+
     /**
      * @brief Connects a listener callback to a specific key.
      *
@@ -997,51 +2624,154 @@ class ConfigStore
     Connection on_change(const std::string &key, std::function<void(const T &)> callback);
 
     /**
-     * @brief Atomically reads a key or initializes it with a default value.
+     * @brief Atomically reads a key or initializes it with a default value.
+     *
+     * If the key already exists and can be decoded as T, returns the stored value.
+     * Otherwise writes default_value for the key and returns it.  A value that
+     * only set_default() provides does not count, in layered stores as well.
+     * When SaveStrategy is Auto the store is saved after initialization.
+     *
+     * @tparam T Type to read/write (must satisfy JsonReadable and JsonWritable).
+     * @param key The configuration key or JSON Pointer path.
+     * @param default_value Value to store and return if the key is absent or unreadable.
+     * @return The existing value, or default_value after initialization.
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T>
+        requires JsonReadable<T> && JsonWritable<T>
+    T get_or_set(std::string_view key, const T &default_value)
+    {
+        if (key.empty())
+            throw std::invalid_argument("get_or_set() requires a non-empty key");
+
+        const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
+        return get_or_set_at(nlohmann::json::json_pointer(ptr_str), key, default_value);
+    }
+
+    /**
+     * @brief Atomically reads or initializes a value through a pre-parsed key.
+     *
+     * @tparam T Type to read/write (must satisfy JsonReadable and JsonWritable).
+     * @param key Handle returned by compile_key().
+     * @param default_value Value to store and return if the key is absent or unreadable.
+     * @return The existing value, or default_value after initialization.
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T>
+        requires JsonReadable<T> && JsonWritable<T>
+    T get_or_set(const Key<T> &key, const std::type_identity_t<T> &default_value)
+    {
+        return get_or_set_at(key.pointer(), key.str(), default_value);
+    }
+
+    /**
+     * @brief Atomic read-or-initialize through a compile-time key.
+     *
+     * @tparam T Type to read/write (must satisfy JsonReadable and JsonWritable).
+     * @param key config::key<"..."> or CONFIG_KEY("...").
+     * @param default_value Value to store and return if the key is absent or unreadable.
+     * @return The existing value, or default_value after initialization.
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T, detail::FixedString S>
+        requires JsonReadable<T> && JsonWritable<T>
+    T get_or_set(const StaticKey<S> &key, const T &default_value)
+    {
+        return get_or_set_at(key.pointer(), key.str(), default_value);
+    }
+
+    /**
+     * @brief Atomically applies fn to the value stored at key.
+     *
+     * Reads, modifies and writes the key under one exclusive lock, so
+     * concurrent updates are never lost.  fn receives the current value, the
+     * registered default if the key is absent, or a value-initialized T if
+     * there is neither; it works on a copy, so an exception from fn leaves the
+     * store unchanged.  The key keeps its encoding.  Listeners and auto-save
+     * behave as for set().  fn runs with the exclusive lock held and must not
+     * call back into the store.
+     *
+     * @code
+     * const int hits = store.update<int>("stats/hits", [](int &n) { ++n; });
+     * @endcode
+     *
+     * @tparam T Type the value is read and written as.
+     * @param key Non-empty configuration key or JSON Pointer path.
+     * @param fn Callable invoked as fn(T &).
+     * @param location Source location for diagnostics.
+     * @return The value written.
+     * @throws std::invalid_argument If key is empty.
+     * @throws std::runtime_error If the stored value is not convertible to T, or the write fails in memory.
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename T, typename F>
+        requires JsonReadable<T> && JsonWritable<T> && std::invocable<F &, T &>
+    T update(std::string_view key, F &&fn, const std::source_location location = std::source_location::current())
+    {
+        return update_value<T>(key_pointer(key, "update()"), key, fn, location);
+    }
+
+    /**
+     * @brief Atomically applies fn to the value stored at a pre-parsed key.
+     * @see update(std::string_view, F &&, std::source_location)
+     */
+    template <typename T, typename F>
+        requires JsonReadable<T> && JsonWritable<T> && std::invocable<F &, T &>
+    T update(const Key<T> &key, F &&fn, const std::source_location location = std::source_location::current())
+    {
+        return update_value<T>(key.pointer(), key.str(), fn, location);
+    }
+
+    /**
+     * @brief Atomically applies fn to the JSON node stored at key.
      *
-     * If the key already exists and can be decoded as T, returns the stored value.
-     * Otherwise writes default_value for the key and returns it.
-     * When SaveStrategy is Auto the store is saved after initialization.
+     * JSON-level counterpart of update(): fn receives the current node (null
+     * if the key and its default are absent) and may change it freely,
+     * including its type.
+     *
+     * @param key Non-empty configuration key or JSON Pointer path.
+     * @param fn Callable invoked as fn(json &).
+     * @param location Source location for diagnostics.
+     * @throws std::invalid_argument If key is empty.
+     * @throws std::runtime_error If the write fails in memory (e.g., path conflict).
+     * @throws SaveError If auto-save is enabled and the disk write fails.
+     */
+    template <typename F>
+        requires std::invocable<F &, json &>
+    void update_json(std::string_view key, F &&fn,
+                     const std::source_location location = std::source_location::current())
+    {
+        update_at(key_pointer(key, "update_json()"), key, [&fn](json &node, bool) { fn(node); }, location);
+    }
+
+    /**
+     * @brief Exception-free counterpart of get_or_set().
      *
      * @tparam T Type to read/write (must satisfy JsonReadable and JsonWritable).
      * @param key The configuration key or JSON Pointer path.
      * @param default_value Value to store and return if the key is absent or unreadable.
-     * @return The existing value, or default_value after initialization.
-     * @throws SaveError If auto-save is enabled and the disk write fails.
+     * @return The existing or initialized value; Error::InvalidKey if the key is
+     *         empty, malformed, or runs through a scalar; Error::SaveFailed if the
+     *         value was written but the auto-save failed.
      */
     template <typename T>
         requires JsonReadable<T> && JsonWritable<T>
-    T get_or_set(std::string_view key, const T &default_value)
+    [[nodiscard]] Expected<T> try_get_or_set(std::string_view key, const T &default_value)
     {
         if (key.empty())
-            throw std::invalid_argument("get_or_set() requires a non-empty key");
-
-        const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-        const nlohmann::json::json_pointer ptr(ptr_str);
-
+            return detail::fail(Error::InvalidKey);
+        try
         {
-            std::unique_lock lock(mutex_);
-            if (data_.contains(ptr))
-            {
-                try
-                {
-                    return data_.at(ptr).get<T>();
-                }
-                catch (...)
-                {
-                }
-            }
-            data_[ptr] = default_value;
+            return get_or_set(key, default_value);
         }
-
-        notify(key, json(default_value));
-
-        if (save_strategy_ == SaveStrategy::Auto)
+        catch (const SaveError &)
         {
-            if (!save())
-                throw SaveError("get_or_set: auto-save failed for key '" + std::string(key) + "'");
+            return detail::fail(Error::SaveFailed);
+        }
+        catch (const nlohmann::json::exception &)
+        {
+            return detail::fail(Error::InvalidKey);
         }
-        return default_value;
     }
 
     /**
@@ -1112,36 +2842,32 @@ class ConfigStore
     /**
      * @brief Returns all immediate child keys at the top level or under a given prefix.
      *
+     * As with contains(), keys only set_default() provides are listed in a
+     * layered store and not otherwise.
+     *
      * @param prefix Empty string for root-level keys, or a key / JSON Pointer path
      *               designating a sub-object.
      * @return Vector of child key names (not full paths).
      */
     std::vector<std::string> keys(std::string_view prefix = "") const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, prefix);
         std::vector<std::string> result;
         if (prefix.empty())
         {
-            if (data_.is_object())
+            if (view.data().is_object())
             {
-                for (const auto &[k, _] : data_.items())
+                for (const auto &[k, _] : view.data().items())
                     result.push_back(k);
             }
         }
         else
         {
-            const std::string ptr_str = (prefix.front() == '/') ? std::string(prefix) : "/" + std::string(prefix);
-            try
-            {
-                const auto &node = data_.at(nlohmann::json::json_pointer(ptr_str));
-                if (node.is_object())
-                {
-                    for (const auto &[k, _] : node.items())
-                        result.push_back(k);
-                }
-            }
-            catch (...)
+            const json *node = find_data(view, prefix);
+            if (node && node->is_object())
             {
+                for (const auto &[k, _] : node->items())
+                    result.push_back(k);
             }
         }
         return result;
@@ -1166,7 +2892,8 @@ class ConfigStore
      * Unlike keys() / children(), which return only the immediate children of one
      * level, this method descends the entire JSON tree and collects every path that
      * leads to a non-object value (scalar, array, or null).  Arrays are treated as
-     * leaf nodes — their elements are not recursed into.
+     * leaf nodes — their elements are not recursed into.  As with contains(),
+     * keys only set_default() provides are listed in a layered store and not otherwise.
      *
      * @param prefix Empty string to start from the root, or a key / JSON Pointer
      *               path to start from a sub-tree.  Results are returned as full
@@ -1175,23 +2902,16 @@ class ConfigStore
      */
     [[nodiscard]] std::vector<std::string> all_keys(std::string_view prefix = "") const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, prefix);
         std::vector<std::string> result;
         if (prefix.empty())
         {
-            collect_keys(data_, "", result);
+            collect_keys(view.data(), "", result);
         }
         else
         {
-            const std::string ptr_str = (prefix.front() == '/') ? std::string(prefix) : "/" + std::string(prefix);
-            try
-            {
-                const auto &node = data_.at(nlohmann::json::json_pointer(ptr_str));
-                collect_keys(node, std::string(prefix), result);
-            }
-            catch (...)
-            {
-            }
+            if (const json *node = find_data(view, prefix))
+                collect_keys(*node, std::string(prefix), result);
         }
         return result;
     }
@@ -1207,8 +2927,8 @@ class ConfigStore
      */
     [[nodiscard]] std::string dump(JsonFormat format = JsonFormat::Pretty) const
     {
-        std::shared_lock lock(mutex_);
-        return format == JsonFormat::Pretty ? data_.dump(4) : data_.dump();
+        const ReadView view(*this);
+        return format == JsonFormat::Pretty ? view.data().dump(4) : view.data().dump();
     }
 
     /**
@@ -1226,32 +2946,49 @@ class ConfigStore
         requires JsonReadable<T>
     [[nodiscard]] std::unordered_map<std::string, T> get_all(std::string_view prefix = "") const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, prefix);
         std::unordered_map<std::string, T> result;
-        const json *node = &data_;
+        const json *node = &view.data();
         if (!prefix.empty())
         {
-            const std::string ptr_str = (prefix.front() == '/') ? std::string(prefix) : "/" + std::string(prefix);
-            try
-            {
-                node = &data_.at(nlohmann::json::json_pointer(ptr_str));
-            }
-            catch (...)
-            {
+            node = find_data(view, prefix);
+            if (!node)
                 return result;
-            }
         }
         if (!node->is_object())
             return result;
         for (const auto &[k, v] : node->items())
         {
-            try
-            {
-                result[k] = v.get<T>();
-            }
-            catch (...)
-            {
-            }
+            if (auto value = detail::convert<T>(v))
+                result[k] = std::move(*value);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Exception-free counterpart of get_all().
+     *
+     * @tparam T Type to deserialize each value into.
+     * @param prefix Empty string for the root object, or a key / JSON Pointer path.
+     * @return Map from child key name to deserialized value (unconvertible entries
+     *         are skipped), Error::KeyNotFound if the prefix does not exist, or
+     *         Error::TypeMismatch if it is not an object.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] Expected<std::unordered_map<std::string, T>> try_get_all(std::string_view prefix = "") const
+    {
+        const ReadView view(*this, prefix);
+        const json *node = prefix.empty() ? &view.data() : find_data(view, prefix);
+        if (!node)
+            return detail::fail(Error::KeyNotFound);
+        if (!node->is_object())
+            return detail::fail(Error::TypeMismatch);
+        std::unordered_map<std::string, T> result;
+        for (const auto &[k, v] : node->items())
+        {
+            if (auto value = detail::convert<T>(v))
+                result[k] = std::move(*value);
         }
         return result;
     }
@@ -1313,18 +3050,11 @@ class ConfigStore
      */
     [[nodiscard]] json sub(std::string_view prefix) const
     {
-        std::shared_lock lock(mutex_);
+        const ReadView view(*this, prefix);
         if (prefix.empty())
-            return data_;
-        const std::string ptr_str = (prefix.front() == '/') ? std::string(prefix) : "/" + std::string(prefix);
-        try
-        {
-            return data_.at(nlohmann::json::json_pointer(ptr_str));
-        }
-        catch (...)
-        {
-            return json::object();
-        }
+            return view.data();
+        const json *node = find_data(view, prefix);
+        return node ? *node : json::object();
     }
 
     /**
@@ -1345,9 +3075,11 @@ class ConfigStore
     {
         if (key.empty())
             throw std::invalid_argument("set_default() requires a non-empty key");
-        std::unique_lock lock(mutex_);
+        WriteGuard guard(*this);
         const std::string ptr_str = (key.front() == '/') ? std::string(key) : "/" + std::string(key);
-        defaults_[nlohmann::json::json_pointer(ptr_str)] = value;
+        defaults_.mut()[nlohmann::json::json_pointer(ptr_str)] = value;
+        if (opts_.layered)
+            relayer_at(guard, ptr_str);
     }
 
     /**
@@ -1355,8 +3087,10 @@ class ConfigStore
      */
     void clear_defaults()
     {
-        std::unique_lock lock(mutex_);
-        defaults_ = json::object();
+        const WriteGuard guard(*this);
+        defaults_.reset(json::object());
+        if (opts_.layered)
+            data_.reset(layers_.flatten(defaults_.get()));
     }
 
     /**
@@ -1370,23 +3104,72 @@ class ConfigStore
      * @throws SaveError If SaveStrategy is Auto and the disk write fails.
      */
     void merge(const json &overlay)
+    {
+        merge(json(overlay));
+    }
+
+    /**
+     * @brief Deep-merges a JSON object, moving its members into the store.
+     *
+     * Same as merge(const json &), but subtrees that are not merged into an
+     * existing object are moved rather than copied.  @p overlay is left in a
+     * valid but unspecified state.
+     *
+     * @param overlay JSON object whose keys override or extend current data.
+     * @throws std::invalid_argument If overlay is not a JSON object.
+     * @throws SaveError If SaveStrategy is Auto and the disk write fails.
+     */
+    void merge(json &&overlay)
     {
         if (!overlay.is_object())
             throw std::invalid_argument("merge() requires a JSON object");
+        std::optional<bool> journaled;
         {
-            std::unique_lock lock(mutex_);
-            deep_merge(data_, overlay);
-        }
-        if (save_strategy_ == SaveStrategy::Auto)
-        {
-            if (!save())
-                throw SaveError("merge: auto-save failed");
+            WriteGuard guard(*this);
+            if (lazy_)
+            {
+                for (const auto &[name, value] : overlay.items())
+                {
+                    std::string key;
+                    detail::json_path::append_escaped(key, name);
+                    materialize_locked(key);
+                }
+            }
+            if (!detail::merge_changes(opts_.layered ? layers_.runtime() : data_.get(), overlay))
+                return;
+            std::optional<json> op;
+            if (journaling())
+                op = detail::Journal::merge(overlay, obfuscation_map_.get());
+            if (opts_.layered)
+            {
+                std::vector<std::string> keys;
+                keys.reserve(overlay.size());
+                for (const auto &[name, value] : overlay.items())
+                {
+                    keys.emplace_back();
+                    detail::json_path::append_escaped(keys.back(), name);
+                }
+                detail::deep_merge(layers_.runtime(), std::move(overlay));
+                for (const auto &key : keys)
+                    relayer_at(guard, key);
+            }
+            else
+            {
+                detail::deep_merge(data_.mut(), std::move(overlay));
+            }
+            if (op)
+                journal_ops_.push_back(std::move(*op));
+            journaled = append_journal();
         }
+        if (!persist(save_strategy_, journaled))
+            throw SaveError("merge: auto-save failed");
     }
 
     /**
      * @brief Loads a JSON file from disk and deep-merges it into current data.
      *
+     * The file is read in StoreOptions::file_format, like the store's own file.
+     *
      * @param path File path to load.
      * @param type Strategy for resolving the file path.
      * @throws std::runtime_error If the file does not exist.
@@ -1397,12 +3180,7 @@ class ConfigStore
         const std::string abs_path = detail::PathResolver::resolve(path, type);
         if (!std::filesystem::exists(abs_path))
             throw std::runtime_error("merge_file: file not found: " + abs_path);
-        json overlay;
-        {
-            std::ifstream f(abs_path);
-            f >> overlay;
-        }
-        merge(overlay);
+        merge(detail::FileCodec::read(abs_path, opts_.file_format));
     }
 
     /**
@@ -1420,7 +3198,7 @@ class ConfigStore
     {
         // Parse all files outside the lock: non-existent and unparseable files are
         // silently skipped so a corrupt optional layer does not block loading.
-        std::vector<json> layers;
+        std::vector<std::pair<std::string, json>> layers;
         layers.reserve(paths.size());
         for (const auto &p : paths)
         {
@@ -1429,10 +3207,7 @@ class ConfigStore
                 continue;
             try
             {
-                json layer_data;
-                std::ifstream f(abs);
-                f >> layer_data;
-                layers.push_back(std::move(layer_data));
+                layers.emplace_back(abs, detail::FileCodec::read(abs, opts_.file_format));
             }
             catch (...)
             {
@@ -1442,21 +3217,71 @@ class ConfigStore
         // Merge all layers in a single lock acquisition so no intermediate state is
         // observable to concurrent readers.  Re-apply env overrides last so they
         // always win over any layer value.  Read save_strategy_ while the lock is
-        // still held to avoid a data race with set_save_strategy().
-        bool should_save = false;
+        // still held to avoid a data race with set_save_strategy().  In layered mode
+        // each file replaces its own layer and only the keys it changed are recomputed.
+        SaveStrategy strategy = SaveStrategy::Manual;
         {
-            std::unique_lock lock(mutex_);
-            for (auto &layer_data : layers)
-                deep_merge(data_, layer_data);
-            if (!layers.empty())
-                apply_env_overrides();
-            should_save = (save_strategy_ == SaveStrategy::Auto);
-        }
-        if (should_save)
-        {
-            if (!save())
-                throw SaveError("load_layered: auto-save failed");
+            WriteGuard guard(*this);
+            if (opts_.layered)
+            {
+                std::vector<std::string> changed;
+                std::string path;
+                for (auto &[name, layer_data] : layers)
+                {
+                    json &layer = layers_.overlay(name);
+                    detail::LayerStack::diff(layer, layer_data, path, changed);
+                    layer = std::move(layer_data);
+                }
+                for (const auto &key : changed)
+                    relayer_at(guard, key);
+            }
+            else
+            {
+                if (!layers.empty())
+                    materialize_locked({});
+                for (auto &[name, layer_data] : layers)
+                    detail::deep_merge(data_.mut(), layer_data);
+                if (!layers.empty())
+                    apply_env_overrides(data_.mut());
+            }
+            strategy = save_strategy_;
         }
+        if (!persist(strategy))
+            throw SaveError("load_layered: auto-save failed");
+    }
+
+    /**
+     * @brief Reports which layer the value of a key comes from.
+     *
+     * Requires StoreOptions::layered.  Layers are, lowest priority first:
+     * "defaults", "file", the absolute path of each file passed to
+     * load_layered(), "env", and "runtime" (set, merge, get_or_set).  For an
+     * object merged from several layers the highest one is reported.
+     *
+     * @param key Key / JSON Pointer path.
+     * @return The layer name, or std::nullopt if the key has no value.
+     * @throws std::logic_error If the store was not created with StoreOptions::layered.
+     */
+    [[nodiscard]] std::optional<std::string> source_of(std::string_view key) const
+    {
+        if (!opts_.layered)
+            throw std::logic_error("source_of() requires StoreOptions::layered");
+        std::shared_lock lock(mutex_);
+        if (key.empty())
+            return std::nullopt; // the root is merged from every layer
+        return layers_.source(defaults_.get(), key);
+    }
+
+    /**
+     * @brief Returns the names of the store's layers, lowest priority first.
+     * @return Layer names as reported by source_of(); empty unless StoreOptions::layered is set.
+     */
+    [[nodiscard]] std::vector<std::string> layer_names() const
+    {
+        if (!opts_.layered)
+            return {};
+        std::shared_lock lock(mutex_);
+        return layers_.names();
     }
 };
 
@@ -1555,25 +3380,150 @@ inline Connection ConfigStore::on_any_change(std::function<void(const T &)> call
     });
 }
 
-namespace detail
-{
-struct StringHash
+/**
+ * @brief Mutation handle passed to ConfigStore::transaction().
+ *
+ * Reads through a Txn see the transaction's own writes.  A Txn is only valid
+ * inside the transaction callback.
+ */
+class Txn
 {
-    using is_transparent = void;
-    size_t operator()(std::string_view sv) const
+    friend class ConfigStore;
+
+    using json = nlohmann::json;
+
+    ConfigStore &store_;
+    ConfigStore::WriteGuard &guard_;
+    std::vector<std::pair<std::string, json>> changes_;
+
+    Txn(ConfigStore &store, ConfigStore::WriteGuard &guard) : store_(store), guard_(guard)
+    {
+    }
+
+  public:
+    Txn(const Txn &)            = delete;
+    Txn &operator=(const Txn &) = delete;
+
+    /**
+     * @brief Sets a value as part of the transaction.
+     *
+     * @tparam T Type of the value to set.
+     * @param key Non-empty configuration key or JSON Pointer path.
+     * @param value The value to store.
+     * @param encoding Encoding method to apply (optional).
+     * @throws std::invalid_argument If key is empty.
+     * @throws nlohmann::json::exception If key is malformed or runs through a scalar.
+     */
+    template <typename T>
+        requires JsonWritable<T>
+    void set(std::string_view key, const T &value, const Encoding encoding = Encoding::None)
+    {
+        if (key.empty())
+            throw std::invalid_argument("Txn::set() requires a non-empty key");
+        const json::json_pointer ptr((key.front() == '/') ? std::string(key) : "/" + std::string(key));
+        json node(value);
+        if (store_.unchanged_at(key, node, encoding))
+            return;
+        json notified = store_.listener_copy(node).value_or(json());
+        store_.write_at(guard_, ptr, key, std::move(node), encoding);
+        changes_.emplace_back(std::string(key), std::move(notified));
+    }
+
+    /**
+     * @brief Removes a key as part of the transaction; missing keys are ignored.
+     * @param key The configuration key or JSON Pointer path.
+     */
+    void remove(std::string_view key)
     {
-        return std::hash<std::string_view>{}(sv);
+        if (store_.erase_at(guard_, key))
+            changes_.emplace_back(std::string(key), nullptr);
     }
-    size_t operator()(const std::string &s) const
+
+    /**
+     * @brief Reads a value, including writes made earlier in the transaction.
+     *
+     * @tparam T Type of the value to retrieve.
+     * @param key The configuration key or JSON Pointer path.
+     * @param default_value The value to return if the key is missing or not convertible to T.
+     * @return The retrieved value or default_value.
+     */
+    template <typename T>
+        requires JsonReadable<T>
+    [[nodiscard]] T get(std::string_view key, const T &default_value) const
     {
-        return std::hash<std::string>{}(s);
+        for (const json *tree : {&store_.data_.get(), &store_.defaults_.get()})
+        {
+            if (const json *node = detail::json_path::find_node(*tree, key))
+            {
+                if (auto value = detail::convert<T>(*node))
+                    return std::move(*value);
+            }
+        }
+        return default_value;
     }
-    size_t operator()(const char *s) const
+
+    /**
+     * @brief Checks if a key exists, including writes made earlier in the transaction.
+     * @param key The configuration key or JSON Pointer path.
+     * @return true if the key exists, false otherwise.
+     */
+    [[nodiscard]] bool contains(std::string_view key) const
     {
-        return std::hash<std::string_view>{}(s);
+        return detail::json_path::find_node(store_.data_.get(), key) != nullptr;
     }
 };
-} // namespace detail
+
+template <typename Fn>
+    requires std::invocable<Fn &, Txn &>
+inline void ConfigStore::transaction(Fn &&fn)
+{
+    std::vector<std::pair<std::string, json>> changes;
+    SaveStrategy strategy = SaveStrategy::Manual;
+    std::optional<bool> journaled;
+    {
+        WriteGuard guard(*this);
+        materialize_locked({});
+        // Sharing the current trees makes the first write copy them, leaving these intact for rollback.
+        std::shared_ptr<const json> old_data = data_.pin();
+        auto old_obfuscation                 = obfuscation_map_;
+        std::shared_ptr<const json> old_persisted;
+        std::optional<detail::LayerStack> old_layers;
+        if (opts_.layered)
+        {
+            old_persisted = persisted_.pin();
+            old_layers    = layers_;
+        }
+
+        Txn txn(*this, guard);
+        try
+        {
+            fn(txn);
+        }
+        catch (...)
+        {
+            data_.restore(std::move(old_data));
+            obfuscation_map_ = std::move(old_obfuscation);
+            if (old_layers)
+            {
+                persisted_.restore(std::move(old_persisted));
+                layers_ = std::move(*old_layers);
+            }
+            path_index_.invalidate();
+            journal_ops_.clear();
+            throw;
+        }
+        changes   = std::move(txn.changes_);
+        strategy  = save_strategy_;
+        journaled = append_journal();
+    }
+    if (changes.empty())
+        return;
+
+    notify_batch(changes);
+
+    if (!persist(strategy, journaled))
+        throw SaveError("transaction: auto-save failed");
+}
 
 namespace registry
 {
@@ -1739,6 +3689,22 @@ template <typename T> void set(std::string_view key, const T &value, Encoding en
 {
     get_default_store().set(key, value, encoding);
 }
+/**
+ * @brief Global convenience function: Sets a value in the default store, moving it in.
+ */
+template <typename T>
+    requires(!std::is_reference_v<T>)
+void set(std::string_view key, T &&value, Encoding encoding = Encoding::None)
+{
+    get_default_store().set(key, std::move(value), encoding);
+}
+/**
+ * @brief Global convenience function: Sets a JSON value in the default store, moving it in.
+ */
+inline void set_json(std::string_view key, nlohmann::json value, Encoding encoding = Encoding::None)
+{
+    get_default_store().set_json(key, std::move(value), encoding);
+}
 /**
  * @brief Global convenience function: Atomically reads or initializes a key in the default store.
  */
@@ -1746,6 +3712,20 @@ template <typename T> inline T get_or_set(std::string_view key, const T &dv)
 {
     return get_default_store().get_or_set<T>(key, dv);
 }
+/**
+ * @brief Global convenience function: Atomically updates a value in the default store.
+ */
+template <typename T, typename F> inline T update(std::string_view key, F &&fn)
+{
+    return get_default_store().update<T>(key, std::forward<F>(fn));
+}
+/**
+ * @brief Global convenience function: Atomically updates a JSON node in the default store.
+ */
+template <typename F> inline void update_json(std::string_view key, F &&fn)
+{
+    get_default_store().update_json(key, std::forward<F>(fn));
+}
 /**
  * @brief Global convenience function: Removes a key from the default store.
  */
@@ -1775,6 +3755,20 @@ inline void remove(std::string_view key)
 {
     return get_default_store().save(format);
 }
+/**
+ * @brief Global convenience function: Saves the default store on its writer thread.
+ */
+[[nodiscard]] inline std::future<bool> save_async()
+{
+    return get_default_store().save_async();
+}
+/**
+ * @brief Global convenience function: Writes pending debounced changes of the default store.
+ */
+[[nodiscard]] inline bool flush()
+{
+    return get_default_store().flush();
+}
 /**
  * @brief Global convenience function: Reloads the default store from disk.
  */
@@ -1789,6 +3783,15 @@ inline void clear()
 {
     get_default_store().clear();
 }
+/**
+ * @brief Global convenience function: Runs a transaction on the default store.
+ */
+template <typename Fn>
+    requires std::invocable<Fn &, Txn &>
+inline void transaction(Fn &&fn)
+{
+    get_default_store().transaction(std::forward<Fn>(fn));
+}
 
 /**
  * @brief Global convenience function: Sets format for the default store.
@@ -1894,6 +3897,14 @@ inline void merge(const nlohmann::json &overlay)
     get_default_store().merge(overlay);
 }
 
+/**
+ * @brief Global convenience function: Deep-merges a JSON object into the default store, moving its members.
+ */
+inline void merge(nlohmann::json &&overlay)
+{
+    get_default_store().merge(std::move(overlay));
+}
+
 /**
  * @brief Global convenience function: Loads a JSON file and merges it into the default store.
  */
@@ -1974,6 +3985,28 @@ template <typename T> [[nodiscard]] inline std::unordered_map<std::string, T> ge
 {
     return get_default_store().get_all<T>(prefix);
 }
+/**
+ * @brief Global convenience function: Retrieves a value from the default store without throwing.
+ */
+template <typename T> [[nodiscard]] inline Expected<T> try_get(std::string_view key)
+{
+    return get_default_store().try_get<T>(key);
+}
+/**
+ * @brief Global convenience function: Reads or initializes a key in the default store without throwing.
+ */
+template <typename T> [[nodiscard]] inline Expected<T> try_get_or_set(std::string_view key, const T &default_value)
+{
+    return get_default_store().try_get_or_set<T>(key, default_value);
+}
+/**
+ * @brief Global convenience function: Returns all values under a prefix of the default store without throwing.
+ */
+template <typename T>
+[[nodiscard]] inline Expected<std::unordered_map<std::string, T>> try_get_all(std::string_view prefix = "")
+{
+    return get_default_store().try_get_all<T>(prefix);
+}
 /**
  * @brief Global convenience function: Sets a default value for a key in the default store.
  */
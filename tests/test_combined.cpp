@@ -4,6 +4,7 @@
 #include <fstream>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <thread>
 #include <vector>
 
@@ -465,6 +466,19 @@ TEST_F(GlobalApiTest, AllGlobalFunctions)
     EXPECT_TRUE(config::save(config::JsonFormat::Pretty));
 }
 
+TEST_F(GlobalApiTest, SetWithExplicitTypeAcceptsLvaluesAndRvalues)
+{
+    const int port = 8080;
+    config::set<int>("port", port);
+    EXPECT_EQ(config::get<int>("port"), 8080);
+
+    std::vector<std::string> hosts{"a", "b"};
+    config::set<std::vector<std::string>>("hosts", hosts);
+    EXPECT_EQ(hosts.size(), 2u);
+    config::set<std::vector<std::string>>("hosts", std::move(hosts));
+    EXPECT_EQ(config::get<std::vector<std::string>>("hosts"), (std::vector<std::string>{"a", "b"}));
+}
+
 // 7. Invalid JsonFormat Coverage (Defensive)
 TEST_F(GlobalApiTest, InvalidJsonFormat)
 {
@@ -1398,3 +1412,2242 @@ TEST_F(DefaultsTest, ThrowingGetAlsoChecksDefaults)
     EXPECT_NO_THROW({ auto v = store.get<int>("port"); });
     EXPECT_EQ(store.get<int>("port"), 8080);
 }
+
+// ==========================================
+// compile_key() Tests
+// ==========================================
+
+struct CompileKeyTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_compile_key.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(CompileKeyTest, RoundTripThroughHandle)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    const auto port = store.compile_key<int>("server/port");
+
+    EXPECT_FALSE(store.contains(port));
+    EXPECT_EQ(store.get(port, 80), 80);
+
+    store.set(port, 8080);
+    EXPECT_TRUE(store.contains(port));
+    EXPECT_EQ(store.get(port), 8080);
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+    EXPECT_EQ(port.str(), "server/port");
+}
+
+TEST_F(CompileKeyTest, SharesSemanticsWithStringKeys)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set_missing_key_policy(config::MissingKeyPolicy::ThrowException);
+    store.set_default("limits/max", 10);
+    const auto max  = store.compile_key<int>("/limits/max");
+    const auto name = store.compile_key<std::string>("name");
+
+    EXPECT_EQ(store.get(max), 10);
+    EXPECT_THROW(store.get(name), std::runtime_error);
+    EXPECT_EQ(store.get_or_set(name, std::string("svc")), "svc");
+    EXPECT_EQ(store.get<std::string>("name"), "svc");
+}
+
+TEST_F(CompileKeyTest, PreSplitReadsMatchStringReads)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.merge({{"a/b", {{"~", 1}}}, {"list", {10, 20}}, {"", 3}});
+
+    std::optional<config::ConfigStore::Key<int>> escaped;
+    {
+        const auto original = store.compile_key<int>("a~1b/~0");
+        escaped             = original; // copies share the parsed segments
+    }
+    EXPECT_EQ(store.get(*escaped), 1);
+    EXPECT_EQ(store.get(store.compile_key<int>("/list/1")), 20);
+    EXPECT_FALSE(store.contains(store.compile_key<int>("list/01")));
+    EXPECT_EQ(store.try_get(store.compile_key<int>("/")).value_or(-1), 3);
+    const std::vector keys{store.compile_key<int>("list/0"), store.compile_key<int>("a~1b/~0")};
+    EXPECT_EQ(store.get_many<int>(keys), (std::vector<int>{10, 1}));
+}
+
+TEST_F(CompileKeyTest, HandleFiresListeners)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    const auto key = store.compile_key<int>("a/b");
+    int seen       = 0;
+    auto conn      = store.on_change<int>("a/b", [&](const int &v) { seen = v; });
+
+    store.set(key, 5);
+    EXPECT_EQ(seen, 5);
+}
+
+TEST_F(CompileKeyTest, RejectsInvalidKeys)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_THROW((void)store.compile_key<int>(""), std::invalid_argument);
+    EXPECT_THROW((void)store.compile_key<int>("bad~key"), std::invalid_argument);
+}
+
+// ==========================================
+// Concurrency::Snapshot Tests
+// ==========================================
+
+struct SnapshotModeTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_snapshot_mode.json";
+    config::StoreOptions opts;
+    void SetUp() override
+    {
+        opts.path_type   = config::Path::Absolute;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.concurrency = config::Concurrency::Snapshot;
+    }
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(SnapshotModeTest, ReadsSeeLatestWrites)
+{
+    config::ConfigStore store(path, opts);
+    store.set("server/port", 8080);
+    store.set_default("server/host", std::string("localhost"));
+
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+    EXPECT_EQ(store.get<std::string>("server/host"), "localhost");
+    EXPECT_TRUE(store.contains("server/port"));
+    EXPECT_EQ(store.keys("server"), std::vector<std::string>{"port"});
+
+    store.remove("server/port");
+    EXPECT_FALSE(store.contains("server/port"));
+    store.clear();
+    EXPECT_FALSE(store.contains(""));
+}
+
+TEST_F(SnapshotModeTest, SubIsUnaffectedByLaterWrites)
+{
+    config::ConfigStore store(path, opts);
+    store.set("a/x", 1);
+    const auto before = store.sub("a");
+    store.set("a/x", 2);
+
+    EXPECT_EQ(before["x"], 1);
+    EXPECT_EQ(store.sub("a")["x"], 2);
+}
+
+TEST_F(SnapshotModeTest, ConcurrentReadersSeeWholeWrites)
+{
+    config::ConfigStore store(path, opts);
+    store.merge({{"pair", {{"a", 0}, {"b", 0}}}});
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&] {
+            while (!stop)
+            {
+                const auto pair = store.sub("pair");
+                if (pair["a"] != pair["b"])
+                    ++torn;
+            }
+        });
+    }
+    for (int i = 1; i <= 500; ++i)
+        store.merge({{"pair", {{"a", i}, {"b", i}}}});
+    stop = true;
+    for (auto &t : readers)
+        t.join();
+
+    EXPECT_EQ(torn, 0);
+    EXPECT_EQ(store.get<int>("pair/a"), 500);
+}
+
+// ===== Conversion Cache Tests =====
+
+struct CountedCfg
+{
+    std::string name;
+    int value = 0;
+    static inline std::atomic<int> conversions{0};
+};
+
+void from_json(const nlohmann::json &j, CountedCfg &c)
+{
+    ++CountedCfg::conversions;
+    j.at("name").get_to(c.name);
+    j.at("value").get_to(c.value);
+}
+
+void to_json(nlohmann::json &j, const CountedCfg &c)
+{
+    j = {{"name", c.name}, {"value", c.value}};
+}
+
+struct ConversionCacheTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_conversion_cache.json";
+    config::StoreOptions opts;
+    void SetUp() override
+    {
+        opts.path_type          = config::Path::Absolute;
+        opts.save               = config::SaveStrategy::Manual;
+        opts.cache_conversions  = true;
+        CountedCfg::conversions = 0;
+    }
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(ConversionCacheTest, RepeatedGetConvertsOnce)
+{
+    config::ConfigStore store(path, opts);
+    store.set("cfg", CountedCfg{"a", 1});
+    CountedCfg::conversions = 0;
+
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(store.get<CountedCfg>("cfg", {}).name, "a");
+    EXPECT_EQ(store.get<CountedCfg>("/cfg", {}).value, 1);
+    EXPECT_EQ(store.get<CountedCfg>(store.compile_key<CountedCfg>("cfg"), CountedCfg{}).value, 1);
+    EXPECT_EQ(CountedCfg::conversions, 1);
+}
+
+TEST_F(ConversionCacheTest, WritesInvalidateCachedValues)
+{
+    config::ConfigStore store(path, opts);
+    store.set("cfg", CountedCfg{"a", 1});
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).value, 1);
+
+    store.set("cfg/value", 2);
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).value, 2);
+
+    store.merge({{"cfg", {{"value", 3}}}});
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).value, 3);
+
+    store.remove("cfg");
+    EXPECT_EQ(store.get<CountedCfg>("cfg", CountedCfg{"fallback", 9}).name, "fallback");
+
+    store.set_default("cfg", CountedCfg{"default", 4});
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).name, "default");
+
+    EXPECT_TRUE(store.save());
+    store.set("cfg", CountedCfg{"unsaved", 5});
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).name, "unsaved");
+    store.reload();
+    EXPECT_EQ(store.get<CountedCfg>("cfg", {}).name, "default");
+}
+
+TEST_F(ConversionCacheTest, DisabledByDefault)
+{
+    opts.cache_conversions = false;
+    config::ConfigStore store(path, opts);
+    store.set("cfg", CountedCfg{"a", 1});
+    CountedCfg::conversions = 0;
+
+    store.get<CountedCfg>("cfg", {});
+    store.get<CountedCfg>("cfg", {});
+    EXPECT_EQ(CountedCfg::conversions, 2);
+}
+
+// ===== Path Index Tests =====
+
+struct PathIndexTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_path_index.json";
+    config::StoreOptions opts;
+    void SetUp() override
+    {
+        opts.path_type   = config::Path::Absolute;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.index_paths = true;
+    }
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(PathIndexTest, LookupsHitTheIndex)
+{
+    config::ConfigStore store(path, opts);
+    store.merge({{"server", {{"host", "localhost"}, {"port", 8080}}}, {"a/b", 1}});
+
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+    EXPECT_EQ(store.get<std::string>("/server/host"), "localhost");
+    EXPECT_EQ(store.get<int>("a~1b"), 1);
+    EXPECT_TRUE(store.contains("server"));
+    EXPECT_TRUE(store.contains(store.compile_key<int>("server/port")));
+
+    const auto stats = store.index_stats();
+    EXPECT_EQ(stats.builds, 1u);
+    EXPECT_EQ(stats.entries, 4u);
+}
+
+TEST_F(PathIndexTest, SetAndRemoveUpdateIndexInPlace)
+{
+    config::ConfigStore store(path, opts);
+    store.set("server/port", 8080);
+    EXPECT_EQ(store.get<int>("server/port"), 8080); // first read builds the index
+
+    store.set("server/tls/enabled", true);
+    store.set("server", nlohmann::json{{"host", "example.com"}});
+    EXPECT_FALSE(store.contains("server/port"));
+    EXPECT_EQ(store.get<std::string>("server/host"), "example.com");
+    EXPECT_EQ(store.get_or_set("limits/max", 5), 5);
+    EXPECT_EQ(store.get<int>("limits/max"), 5);
+
+    store.remove("server");
+    EXPECT_FALSE(store.contains("server/host"));
+    EXPECT_FALSE(store.contains("server"));
+
+    const auto stats = store.index_stats();
+    EXPECT_EQ(stats.builds, 1u);
+    EXPECT_EQ(stats.entries, 2u); // limits, limits/max
+}
+
+TEST_F(PathIndexTest, BulkWritesRebuildAndArraysFallBack)
+{
+    config::ConfigStore store(path, opts);
+    store.set("list", std::vector<int>{1, 2, 3});
+    EXPECT_EQ(store.get<int>("list/1"), 2); // array elements are not indexed
+    EXPECT_FALSE(store.contains("list/3"));
+    EXPECT_FALSE(store.contains("list/1/x"));
+    store.set("items", nlohmann::json::array({{{"name", "a"}}}));
+    EXPECT_EQ(store.get<std::string>("items/0/name"), "a");
+    EXPECT_FALSE(store.contains("items/0/size"));
+
+    store.merge({{"x", 1}});
+    EXPECT_EQ(store.get<int>("x"), 1);
+    store.clear();
+    EXPECT_FALSE(store.contains("x"));
+    EXPECT_EQ(store.index_stats().builds, 3u);
+}
+
+TEST_F(PathIndexTest, EmptyNamedMembersResolveAsWithoutIndex)
+{
+    for (const bool index_paths : {false, true})
+    {
+        SCOPED_TRACE(index_paths);
+        opts.index_paths = index_paths;
+        config::ConfigStore store(path, opts);
+        store.set("/", 5);
+        store.set("list", std::vector<int>{1, 2});
+
+        EXPECT_EQ(store.get<int>("/", -1), 5);
+        EXPECT_TRUE(store.contains("/"));
+        EXPECT_TRUE(store.contains(""));
+        EXPECT_FALSE(store.contains("list/"));
+        EXPECT_FALSE(store.contains("//x"));
+
+        store.set("/", nlohmann::json{{"x", 1}});
+        EXPECT_EQ(store.get<int>("//x", -1), 1);
+        EXPECT_FALSE(store.contains("x"));
+    }
+}
+
+TEST_F(PathIndexTest, DisabledInSnapshotMode)
+{
+    opts.concurrency = config::Concurrency::Snapshot;
+    config::ConfigStore store(path, opts);
+    store.set("k", 1);
+    EXPECT_EQ(store.get<int>("k"), 1);
+    EXPECT_EQ(store.index_stats().builds, 0u);
+}
+
+// ===== Key Path Lookup Tests =====
+
+struct KeyPathLookupTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_key_path_lookup.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(KeyPathLookupTest, EscapedSegmentsMatchJsonPointer)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.merge({{"a/b", 1}, {"m~n", 2}, {"", {{"empty", 3}}}});
+
+    EXPECT_EQ(store.get<int>("a~1b"), 1);
+    EXPECT_EQ(store.get<int>("/m~0n"), 2);
+    EXPECT_EQ(store.get<int>("//empty"), 3);
+    EXPECT_TRUE(store.contains("/"));
+    EXPECT_FALSE(store.contains("a/b"));
+    EXPECT_FALSE(store.contains("m~2n")); // invalid escape
+    EXPECT_EQ(store.get<int>("m~", -1), -1);
+}
+
+TEST_F(KeyPathLookupTest, ArrayIndicesFollowRfc6901)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("list", nlohmann::json::array({10, {{"x", 20}}, 30}));
+
+    EXPECT_EQ(store.get<int>("list/0"), 10);
+    EXPECT_EQ(store.get<int>("list/1/x"), 20);
+    EXPECT_FALSE(store.contains("list/3"));
+    EXPECT_FALSE(store.contains("list/01"));
+    EXPECT_FALSE(store.contains("list/-"));
+    EXPECT_FALSE(store.contains("list/x"));
+    EXPECT_FALSE(store.contains("list/99999999999999999999999"));
+}
+
+TEST_F(KeyPathLookupTest, ScalarsHaveNoChildren)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("port", 8080);
+    store.set_default("server/port", 1);
+
+    EXPECT_FALSE(store.contains("port/x"));
+    EXPECT_EQ(store.get<int>("port/x", 7), 7);
+    EXPECT_EQ(store.get<int>("server/port"), 1); // resolved from the defaults layer
+    EXPECT_EQ(store.sub("port/x"), nlohmann::json::object());
+    EXPECT_TRUE(store.keys("port").empty());
+}
+
+// ===== Live Value Tests =====
+
+struct LiveValueTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_live_value.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(LiveValueTest, TracksWrites)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("limits/max_conn", 10);
+    const auto max_conn = store.live<int>("limits/max_conn");
+    static_assert(config::Live<int>::is_lock_free);
+    EXPECT_EQ(max_conn.load(), 10);
+
+    store.set("limits/max_conn", 20);
+    EXPECT_EQ(max_conn.load(), 20);
+    store.merge({{"limits", {{"max_conn", 30}}}});
+    EXPECT_EQ(max_conn.load(), 30);
+    store.remove("limits/max_conn");
+    EXPECT_EQ(max_conn.load(), 0);
+    store.set_default("limits/max_conn", 5);
+    EXPECT_EQ(max_conn.load(), 5);
+}
+
+TEST_F(LiveValueTest, TracksReload)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    const auto host = store.live<std::string>("server/host", "localhost");
+    static_assert(!config::Live<std::string>::is_lock_free);
+    EXPECT_EQ(*host.load(), "localhost");
+
+    {
+        std::ofstream f(path);
+        f << R"({"server": {"host": "example.com"}})";
+    }
+    store.reload();
+    EXPECT_EQ(*host.load(), "example.com");
+}
+
+TEST_F(LiveValueTest, HandleAndStoreLifetimesAreIndependent)
+{
+    config::Live<int> survivor = [&] {
+        config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+        store.set("k", 1);
+        {
+            const auto dropped = store.live<int>("k");
+        }
+        store.set("k", 2); // prunes the dropped handle
+        return store.live<int>("k");
+    }();
+    EXPECT_EQ(survivor.load(), 2);
+}
+
+// ===== Get Many Tests =====
+
+struct GetManyTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_get_many.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(GetManyTest, TupleFormResolvesMixedTypes)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.merge({{"server", {{"host", "localhost"}, {"port", 8080}}}});
+    store.set_default("server/tls", true);
+
+    const auto host = store.compile_key<std::string>("server/host");
+    const auto port = store.compile_key<int>("server/port");
+    const auto tls  = store.compile_key<bool>("server/tls");
+
+    const auto [h, p, t] = store.get_many(host, port, tls);
+    EXPECT_EQ(h, "localhost");
+    EXPECT_EQ(p, 8080);
+    EXPECT_TRUE(t);
+}
+
+TEST_F(GetManyTest, SpanFormPreservesOrderAndPolicy)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.merge({{"a", 1}, {"b", 2}});
+    const std::vector<config::ConfigStore::Key<int>> keys{store.compile_key<int>("b"), store.compile_key<int>("missing"),
+                                                          store.compile_key<int>("a")};
+    EXPECT_EQ(store.get_many(std::span(keys)), (std::vector<int>{2, 0, 1}));
+
+    store.set_missing_key_policy(config::MissingKeyPolicy::ThrowException);
+    EXPECT_THROW((void)store.get_many(std::span(keys)), std::runtime_error);
+}
+
+// ===== Scalar Slot Tests =====
+
+struct ScalarSlotTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_scalar_slot.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(ScalarSlotTest, RegisteredKeysFollowWrites)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("limits/max_conn", 10);
+    const auto max_conn = store.register_scalar<int>("limits/max_conn");
+    const auto ratio    = store.register_scalar<double>("limits/ratio");
+    const auto enabled  = store.register_scalar<bool>("feature/enabled");
+
+    EXPECT_EQ(store.get(max_conn), 10);
+    EXPECT_DOUBLE_EQ(store.get(ratio, 0.5), 0.5);
+    store.set(ratio, 0.75);
+    store.merge({{"limits", {{"max_conn", 20}}}, {"feature", {{"enabled", true}}}});
+    EXPECT_EQ(store.get(max_conn), 20);
+    EXPECT_DOUBLE_EQ(store.get(ratio), 0.75);
+    EXPECT_TRUE(store.get(enabled));
+
+    store.remove("limits/max_conn");
+    EXPECT_EQ(store.get(max_conn, -1), -1);
+    store.set_default("limits/max_conn", 5);
+    EXPECT_EQ(store.get(max_conn), 5);
+}
+
+TEST_F(ScalarSlotTest, MissesKeepPolicyAndTypeChecks)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("flag", std::string("yes"));
+    const auto flag = store.register_scalar<bool>("flag");
+    EXPECT_FALSE(store.get(flag, false));
+
+    store.set_missing_key_policy(config::MissingKeyPolicy::ThrowException);
+    EXPECT_THROW((void)store.get(flag), std::runtime_error);
+}
+
+TEST_F(ScalarSlotTest, KeyFromAnotherStoreReadsItsOwnStore)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    config::ConfigStore other(path + ".other", config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("n", 1);
+    other.set("n", 2);
+    const auto n = store.register_scalar<int>("n");
+    EXPECT_EQ(other.get(n), 2);
+    std::filesystem::remove(path + ".other");
+}
+
+TEST_F(ScalarSlotTest, KeyOutlivingItsStoreIgnoresStoreAtSameAddress)
+{
+    std::optional<config::ConfigStore> store;
+    store.emplace(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store->set("n", 1);
+    const auto n = store->register_scalar<int>("n");
+
+    store.emplace(path + ".other", config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(store->get(n, -1), -1);
+    store->set("n", 2);
+    EXPECT_EQ(store->get(n), 2);
+    store.reset();
+    std::filesystem::remove(path + ".other");
+}
+
+TEST_F(ScalarSlotTest, KeyedWritesRefreshOverlappingKeysOnly)
+{
+    using config::detail::json_path::overlaps;
+    EXPECT_TRUE(overlaps("a/b", "a"));
+    EXPECT_TRUE(overlaps("/a", "a/b/c"));
+    EXPECT_TRUE(overlaps("a/b", ""));
+    EXPECT_FALSE(overlaps("ab", "a"));
+    EXPECT_FALSE(overlaps("a/b", "a/c"));
+
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    const auto port  = store.register_scalar<int>("server/port");
+    const auto other = store.register_scalar<int>("serverx");
+    const auto live  = store.live<int>("server/port", -1);
+
+    store.set("server", nlohmann::json{{"port", 80}});
+    EXPECT_EQ(store.get(port, 0), 80);
+    EXPECT_EQ(live.load(), 80);
+    store.set("serverx", 5);
+    EXPECT_EQ(store.get(other, 0), 5);
+    EXPECT_EQ(store.get(port, 0), 80);
+
+    store.remove("server");
+    EXPECT_EQ(store.get(port, 0), 0);
+    EXPECT_EQ(live.load(), -1);
+    (void)store.update<int>("serverx", [](int &n) { n *= 2; });
+    EXPECT_EQ(store.get(other, 0), 10);
+    store.set_default("server/port", 443);
+    EXPECT_EQ(store.get(port, 0), 443);
+    EXPECT_EQ(live.load(), 443);
+}
+
+TEST_F(ScalarSlotTest, ArrayWritesRefreshShiftedIndices)
+{
+    using config::detail::json_path::through_array;
+    EXPECT_TRUE(through_array(nlohmann::json::object(), "list/-"));
+    EXPECT_TRUE(through_array(nlohmann::json{{"arr", {1}}}, "/arr/0"));
+    EXPECT_FALSE(through_array(nlohmann::json{{"arr", {1}}}, "arr"));
+
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("arr", nlohmann::json{10, 20, 30});
+    const auto live   = store.live<int>("arr/3", -1);
+    const auto padded = store.live<nlohmann::json>("arr/4", "missing");
+
+    store.set("arr/-", 99);
+    EXPECT_EQ(store.get<int>("arr/3"), 99);
+    EXPECT_EQ(live.load(), 99);
+
+    // Writing past the end pads the array with nulls, so arr/4 comes into existence too.
+    store.set("arr/5", 1);
+    EXPECT_TRUE(padded.load()->is_null());
+}
+
+TEST_F(ScalarSlotTest, ConcurrentReadersNeverSeeTornValues)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("v", int64_t{0});
+    const auto v = store.register_scalar<int64_t>("v");
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> bad{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&] {
+            while (!stop)
+            {
+                const int64_t value = store.get(v);
+                if (value % 0x100000001LL != 0)
+                    ++bad;
+            }
+        });
+    }
+    for (int64_t i = 1; i <= 2000; ++i)
+        store.set(v, i * 0x100000001LL);
+    stop = true;
+    for (auto &t : readers)
+        t.join();
+
+    EXPECT_EQ(bad, 0);
+    EXPECT_EQ(store.get(v), 2000 * 0x100000001LL);
+}
+
+// ===== Try Get Tests =====
+
+struct TryGetTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_try_get.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(TryGetTest, ReportsValueOrError)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual,
+                              config::MissingKeyPolicy::ThrowException);
+    store.merge({{"port", 8080}, {"host", "localhost"}, {"flag", 1}});
+    store.set_default("timeout", 30);
+
+    const auto port = store.try_get<int>("port");
+    ASSERT_TRUE(port.has_value());
+    EXPECT_EQ(*port, 8080);
+    EXPECT_EQ(store.try_get<int>("timeout").value(), 30);
+    EXPECT_EQ(store.try_get<std::string>(store.compile_key<std::string>("host")).value_or(""), "localhost");
+
+    EXPECT_EQ(store.try_get<int>("missing").error(), config::Error::KeyNotFound);
+    EXPECT_EQ(store.try_get<int>("host").error(), config::Error::TypeMismatch);
+    EXPECT_EQ(store.try_get<bool>("flag").error(), config::Error::TypeMismatch);
+    EXPECT_EQ(store.try_get<std::string>("port").error(), config::Error::TypeMismatch);
+    EXPECT_EQ(store.try_get<RootCfg>("port").error(), config::Error::TypeMismatch);
+}
+
+TEST_F(TryGetTest, TypeMismatchFallsThroughToDefaults)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("retries", std::string("three"));
+    store.set_default("retries", 3);
+    EXPECT_EQ(store.try_get<int>("retries").value(), 3);
+    EXPECT_EQ(store.get<int>("retries"), 3);
+}
+
+TEST_F(TryGetTest, TryGetOrSetReportsWriteFailures)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("scalar", 1);
+
+    EXPECT_EQ(store.try_get_or_set("a/b", 5).value(), 5);
+    EXPECT_EQ(store.try_get_or_set("a/b", 9).value(), 5);
+    EXPECT_EQ(store.try_get_or_set("scalar/child", 1).error(), config::Error::InvalidKey);
+    EXPECT_EQ(store.try_get_or_set("", 1).error(), config::Error::InvalidKey);
+}
+
+TEST_F(TryGetTest, TryGetAllDistinguishesMissingAndNonObject)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.merge({{"ports", {{"http", 80}, {"https", 443}, {"name", "x"}}}, {"leaf", 1}});
+
+    const auto ports = store.try_get_all<int>("ports");
+    ASSERT_TRUE(ports);
+    EXPECT_EQ(ports->size(), 2u);
+    EXPECT_EQ(store.try_get_all<int>("nope").error(), config::Error::KeyNotFound);
+    EXPECT_EQ(store.try_get_all<int>("leaf").error(), config::Error::TypeMismatch);
+}
+
+// ===== Layered Store Tests =====
+
+struct LayeredTest : ::testing::Test
+{
+    std::string path    = std::filesystem::temp_directory_path().string() + "/test_layered.json";
+    std::string overlay = std::filesystem::temp_directory_path().string() + "/test_layered_overlay.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(overlay);
+    }
+    static void write(const std::string &file, const nlohmann::json &content)
+    {
+        std::ofstream(file) << content.dump();
+    }
+    config::StoreOptions options(const bool index_paths = false) const
+    {
+        config::StoreOptions opts;
+        opts.path_type   = config::Path::Absolute;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.layered     = true;
+        opts.index_paths = index_paths;
+        return opts;
+    }
+};
+
+TEST_F(LayeredTest, ReportsSourceOfEachKey)
+{
+    write(path, {{"a", 1}, {"server", {{"host", "base"}, {"port", 80}}}});
+    write(overlay, {{"server", {{"port", 8080}}}});
+    config::ConfigStore store(path, options());
+    store.set_default("timeout", 30);
+    store.load_layered({overlay}, config::Path::Absolute);
+    store.set("r", 4);
+
+    const auto names = store.layer_names();
+    ASSERT_EQ(names.size(), 5u);
+    EXPECT_EQ(names.front(), "defaults");
+    EXPECT_EQ(names[1], "file");
+    EXPECT_EQ(names[3], "env");
+    EXPECT_EQ(names.back(), "runtime");
+
+    EXPECT_EQ(store.source_of("a"), "file");
+    EXPECT_EQ(store.source_of("server/host"), "file");
+    EXPECT_EQ(store.source_of("server/port"), names[2]);
+    EXPECT_EQ(store.source_of("server"), names[2]);
+    EXPECT_EQ(store.source_of("timeout"), "defaults");
+    EXPECT_EQ(store.source_of("/r"), "runtime");
+    EXPECT_FALSE(store.source_of("missing").has_value());
+
+    EXPECT_EQ(store.get<std::string>("server/host"), "base");
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+    EXPECT_EQ(store.get<int>("timeout"), 30);
+    EXPECT_TRUE(store.contains("timeout"));
+}
+
+TEST_F(LayeredTest, RuntimeSetsOutrankFilesAndRemoveRevealsDefaults)
+{
+    write(path, {{"port", 80}, {"list", {1, 2, 3}}});
+    write(overlay, {{"port", 8080}});
+    config::ConfigStore store(path, options());
+    store.set_default("port", 1);
+    store.set("port", 9000);
+    store.load_layered({overlay}, config::Path::Absolute);
+    EXPECT_EQ(store.get<int>("port"), 9000);
+
+    store.remove("port");
+    EXPECT_EQ(store.get<int>("port"), 1);
+    EXPECT_EQ(store.source_of("port"), "defaults");
+
+    store.set("list/1", 9);
+    EXPECT_EQ(store.get<std::vector<int>>("list"), (std::vector<int>{1, 9, 3}));
+    EXPECT_EQ(store.source_of("list"), "runtime");
+
+    EXPECT_THROW((void)config::ConfigStore(path, config::Path::Absolute).source_of("port"), std::logic_error);
+}
+
+TEST_F(LayeredTest, GetOrSetWritesKeysOnlyDefaultsHold)
+{
+    write(path, {{"port", 80}});
+    config::ConfigStore store(path, options());
+    store.set_default("port", 1);
+    store.set_default("timeout", 30);
+
+    EXPECT_EQ(store.get_or_set("port", 8), 80);
+    EXPECT_EQ(store.get_or_set("timeout", 60), 60); // as in a flat store, defaults do not count as set
+    EXPECT_EQ(store.source_of("timeout"), "runtime");
+    EXPECT_EQ(store.get_or_set("timeout", 90), 60);
+
+    store.remove("timeout");
+    EXPECT_EQ(store.get<int>("timeout"), 30);
+}
+
+TEST_F(LayeredTest, RelayeringRecomputesChangedKeys)
+{
+    write(path, {{"s", {{"x", 0}, {"z", 3}}}});
+    write(overlay, {{"s", {{"x", 1}, {"y", 2}}}});
+    config::ConfigStore store(path, options(true));
+    store.load_layered({overlay}, config::Path::Absolute);
+    EXPECT_EQ(store.get<int>("s/x"), 1);
+    EXPECT_EQ(store.get<int>("s/y"), 2);
+
+    write(overlay, {{"s", {{"y", 5}}}});
+    store.load_layered({overlay}, config::Path::Absolute);
+    EXPECT_EQ(store.layer_names().size(), 5u);
+    EXPECT_EQ(store.get<int>("s/x"), 0);
+    EXPECT_EQ(store.source_of("s/x"), "file");
+    EXPECT_EQ(store.get<int>("s/y"), 5);
+    EXPECT_EQ(store.get<int>("s/z"), 3);
+
+    store.set("s", 5);
+    EXPECT_EQ(store.get<int>("s/y", -1), -1);
+    EXPECT_FALSE(store.source_of("s/y").has_value());
+
+    write(path, {{"s", {{"x", 7}}}});
+    store.reload();
+    EXPECT_EQ(store.get<int>("s/x"), 7);
+    EXPECT_EQ(store.get<int>("s/y"), 5);
+    EXPECT_FALSE(store.contains("s/z"));
+    EXPECT_EQ(store.dump(config::JsonFormat::Compact), R"({"s":{"x":7,"y":5}})");
+}
+
+TEST_F(LayeredTest, SaveAndClearLeaveDefaultsOut)
+{
+    config::ConfigStore store(path, options());
+    store.set_default("d", 1);
+    store.set("a", 2);
+    ASSERT_TRUE(store.save());
+
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved, (nlohmann::json{{"a", 2}}));
+
+    store.clear();
+    EXPECT_FALSE(store.contains("a"));
+    EXPECT_EQ(store.get<int>("d"), 1);
+    EXPECT_EQ(store.source_of("d"), "defaults");
+}
+
+TEST_F(LayeredTest, DefaultsCountAsPresentOnlyWhenLayered)
+{
+    for (const bool layered : {false, true})
+    {
+        config::StoreOptions opts = options();
+        opts.layered              = layered;
+        config::ConfigStore store(path, opts);
+        store.set_default("server/port", 80);
+        store.set("name", std::string("svc"));
+
+        EXPECT_EQ(store.get<int>("server/port"), 80);
+        EXPECT_EQ(store.contains("server/port"), layered);
+        EXPECT_EQ(store.keys().size(), layered ? 2u : 1u);
+        EXPECT_EQ(store.all_keys().size(), layered ? 2u : 1u);
+        store.transaction([&](config::Txn &t) { EXPECT_EQ(t.contains("server/port"), layered); });
+    }
+}
+
+TEST_F(LayeredTest, SavedViewTracksEveryLayerChange)
+{
+    write(path, {{"list", {1, 2, 3}}, {"server", {{"host", "base"}}}});
+    write(overlay, {{"server", {{"port", 8080}}}});
+    config::ConfigStore store(path, options());
+    store.set_default("server", nlohmann::json{{"timeout", 30}});
+    store.load_layered({overlay}, config::Path::Absolute);
+    store.set("list/1", 9);
+    store.merge({{"extra", {{"on", true}}}});
+    store.remove("server/host");
+    EXPECT_THROW(store.transaction([](config::Txn &t) {
+        t.set("server/port", 1);
+        throw std::runtime_error("abort");
+    }),
+                 std::runtime_error);
+
+    const auto saved = [&] {
+        EXPECT_TRUE(store.save());
+        nlohmann::json json;
+        std::ifstream(path) >> json;
+        return json;
+    };
+    EXPECT_EQ(saved(), (nlohmann::json{{"list", {1, 9, 3}}, {"server", {{"port", 8080}}}, {"extra", {{"on", true}}}}));
+
+    write(overlay, {{"server", {{"port", 9090}}}});
+    store.load_layered({overlay}, config::Path::Absolute);
+    store.set_default("server/host", std::string("fallback"));
+    EXPECT_EQ(store.get<std::string>("server/host"), "fallback");
+    EXPECT_EQ(saved(), (nlohmann::json{{"list", {1, 9, 3}}, {"server", {{"port", 9090}}}, {"extra", {{"on", true}}}}));
+}
+
+// ===== Static Key Tests =====
+
+struct StaticKeyTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_static_key.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+static_assert(config::key<"server/port">.str() == "server/port");
+static_assert(config::StaticKey<"/a~1b/c~0d/0">::split().segments.size() == 3);
+static_assert(config::StaticKey<"/a~1b/c~0d/0">::split().segments[0].name == "a/b");
+static_assert(config::StaticKey<"/a~1b/c~0d/0">::split().segments[1].name == "c~d");
+static_assert(config::StaticKey<"/a~1b/c~0d/0">::split().segments[2].index == 0);
+static_assert(!config::detail::valid_key("") && !config::detail::valid_key("a~2") && !config::detail::valid_key("a~"));
+
+TEST_F(StaticKeyTest, ReadsAndWritesThroughCompileTimeKeys)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set(config::key<"server/port">, 8080);
+    store.set("a/b", nlohmann::json{{"c", 1}});
+    store.set("list", std::vector<int>{10, 20, 30});
+
+    EXPECT_EQ(store.get<int>(CONFIG_KEY("server/port")), 8080);
+    EXPECT_EQ(store.get<int>(config::key<"/server/port">), 8080);
+    EXPECT_EQ(store.get(config::key<"server/host">, std::string("localhost")), "localhost");
+    EXPECT_EQ(store.get<int>(config::key<"a~1b/c">, 0), 0);
+    EXPECT_EQ(store.get<int>(config::key<"list/1">), 20);
+    EXPECT_EQ(store.get<int>(config::key<"list/01">, -1), -1);
+    EXPECT_TRUE(store.contains(config::key<"server/port">));
+    EXPECT_FALSE(store.contains(config::key<"server/host">));
+    EXPECT_EQ(store.try_get<int>(config::key<"server/host">).error(), config::Error::KeyNotFound);
+    EXPECT_EQ(store.get_or_set(config::key<"server/host">, std::string("h")), "h");
+    EXPECT_EQ(store.get<std::string>("server/host"), "h");
+
+    store.set(config::key<"odd~1name">, true);
+    EXPECT_TRUE(store.get<bool>(config::key<"odd~1name">));
+    EXPECT_TRUE(store.sub("").contains("odd/name"));
+
+    store.remove(config::key<"server/port">);
+    EXPECT_FALSE(store.contains(config::key<"server/port">));
+}
+
+TEST_F(StaticKeyTest, MatchesStringKeysAcrossOptions)
+{
+    config::StoreOptions opts;
+    opts.path_type         = config::Path::Absolute;
+    opts.save              = config::SaveStrategy::Manual;
+    opts.on_missing        = config::MissingKeyPolicy::ThrowException;
+    opts.index_paths       = true;
+    opts.cache_conversions = true;
+    config::ConfigStore store(path, opts);
+    store.set("db/hosts", std::vector<std::string>{"a", "b"});
+    store.set_default("db/port", 5432);
+
+    using Hosts = std::vector<std::string>;
+    EXPECT_EQ(store.get<Hosts>(config::key<"db/hosts">), store.get<Hosts>("db/hosts"));
+    EXPECT_EQ(store.get<int>(config::key<"db/port">), 5432);
+    try
+    {
+        (void)store.get<int>(config::key<"db/missing">);
+        FAIL() << "expected a missing-key exception";
+    }
+    catch (const std::runtime_error &e)
+    {
+        EXPECT_NE(std::string(e.what()).find("db/missing"), std::string::npos);
+    }
+}
+
+// ===== Transaction Tests =====
+
+struct TransactionTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_transaction.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(TransactionTest, AppliesAllChangesAndSavesOnce)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    store.set("old", 1);
+
+    store.transaction([](config::Txn &t) {
+        for (int i = 0; i < 50; ++i)
+            t.set("keys/k" + std::to_string(i), i);
+        t.remove("old");
+        EXPECT_EQ(t.get<int>("keys/k7", -1), 7);
+        EXPECT_FALSE(t.contains("old"));
+    });
+
+    EXPECT_EQ(store.get<int>("keys/k49"), 49);
+    EXPECT_FALSE(store.contains("old"));
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved["keys"].size(), 50u);
+    EXPECT_FALSE(saved.contains("old"));
+}
+
+TEST_F(TransactionTest, RollsBackOnException)
+{
+    config::StoreOptions opts;
+    opts.path_type   = config::Path::Absolute;
+    opts.save        = config::SaveStrategy::Manual;
+    opts.index_paths = true;
+    config::ConfigStore store(path, opts);
+    store.set("a", 1);
+    store.set("b/c", 2);
+    int calls       = 0;
+    const auto conn = store.on_any_change([&](const nlohmann::json &) { ++calls; });
+
+    EXPECT_THROW(store.transaction([](config::Txn &t) {
+        t.set("a", 10);
+        t.remove("b/c");
+        t.set("new", true, config::Encoding::Base64);
+        throw std::runtime_error("abort");
+    }),
+                 std::runtime_error);
+
+    EXPECT_EQ(store.get<int>("a"), 1);
+    EXPECT_EQ(store.get<int>("b/c"), 2);
+    EXPECT_FALSE(store.contains("new"));
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(TransactionTest, NotifiesListenersOncePerBatch)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    int server_calls = 0;
+    int any_calls    = 0;
+    nlohmann::json server_value;
+    nlohmann::json change_set;
+    const auto c1 = store.connect("server", [&](const nlohmann::json &v) {
+        ++server_calls;
+        server_value = v;
+    });
+    const auto c2 = store.on_any_change([&](const nlohmann::json &v) {
+        ++any_calls;
+        change_set = v;
+    });
+
+    store.transaction([](config::Txn &t) {
+        t.set("server/host", std::string("h"));
+        t.set("server/port", 80);
+        t.set("other", 1);
+    });
+
+    EXPECT_EQ(server_calls, 1);
+    EXPECT_EQ(server_value, (nlohmann::json{{"host", "h"}, {"port", 80}}));
+    EXPECT_EQ(any_calls, 1);
+    EXPECT_EQ(change_set, (nlohmann::json{{"server/host", "h"}, {"server/port", 80}, {"other", 1}}));
+
+    store.transaction([](config::Txn &) {});
+    EXPECT_EQ(any_calls, 1);
+}
+
+TEST_F(TransactionTest, RemovingMissingKeysChangesNothing)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    int calls       = 0;
+    const auto conn = store.on_any_change([&](const nlohmann::json &) { ++calls; });
+
+    store.transaction([](config::Txn &t) {
+        t.remove("missing");
+        t.remove("missing/child");
+    });
+
+    EXPECT_EQ(calls, 0);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+// ===== Debounced Save Tests =====
+
+struct DebouncedSaveTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_debounced.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    config::StoreOptions options(std::chrono::milliseconds quiet, std::chrono::milliseconds max_delay) const
+    {
+        config::StoreOptions opts;
+        opts.path_type         = config::Path::Absolute;
+        opts.save              = config::SaveStrategy::Debounced;
+        opts.save_quiet_period = quiet;
+        opts.save_max_delay    = max_delay;
+        return opts;
+    }
+};
+
+TEST_F(DebouncedSaveTest, CoalescesWritesAfterQuietPeriod)
+{
+    config::ConfigStore store(path, options(std::chrono::milliseconds(50), std::chrono::hours(1)));
+    for (int i = 0; i < 20; ++i)
+        store.set("k" + std::to_string(i), i);
+    EXPECT_FALSE(std::filesystem::exists(path));
+
+    for (int i = 0; i < 100 && !std::filesystem::exists(path); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved.size(), 20u);
+    EXPECT_EQ(saved["k19"], 19);
+}
+
+TEST_F(DebouncedSaveTest, MaxDelayBoundsStaleness)
+{
+    config::ConfigStore store(path, options(std::chrono::milliseconds(200), std::chrono::milliseconds(50)));
+    // Writes every 10 ms never leave a 200 ms quiet period; the 50 ms cap must still force a save.
+    bool saved = false;
+    for (int i = 0; i < 200 && !saved; ++i)
+    {
+        store.set("tick", i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        saved = std::filesystem::exists(path);
+    }
+    EXPECT_TRUE(saved);
+}
+
+TEST_F(DebouncedSaveTest, FlushAndDestructorWritePendingChanges)
+{
+    {
+        config::ConfigStore store(path, options(std::chrono::hours(1), std::chrono::hours(1)));
+        store.set("a", 1);
+        EXPECT_TRUE(store.flush());
+        nlohmann::json saved;
+        std::ifstream(path) >> saved;
+        EXPECT_EQ(saved["a"], 1);
+
+        store.set("b", 2);
+        store.remove("a");
+    }
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved, (nlohmann::json{{"b", 2}}));
+}
+
+TEST_F(DebouncedSaveTest, SwitchingStrategyWritesPendingChanges)
+{
+    config::ConfigStore store(path, options(std::chrono::hours(1), std::chrono::hours(1)));
+    store.set("a", 1);
+    EXPECT_FALSE(std::filesystem::exists(path));
+    store.set_save_strategy(config::SaveStrategy::Manual);
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved["a"], 1);
+    EXPECT_TRUE(store.flush());
+}
+
+// ===== Async Save Tests =====
+
+struct SaveAsyncTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_save_async.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(SaveAsyncTest, WritesCurrentStateOffThread)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("a", 1);
+    auto done = store.save_async();
+    EXPECT_TRUE(done.get());
+
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved["a"], 1);
+}
+
+TEST_F(SaveAsyncTest, OverlappingRequestsSeeLatestState)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    std::vector<std::future<bool>> done;
+    for (int i = 0; i < 50; ++i)
+    {
+        store.set("n", i);
+        done.push_back(store.save_async());
+    }
+    for (auto &f : done)
+        EXPECT_TRUE(f.get());
+
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved["n"], 49);
+}
+
+TEST_F(SaveAsyncTest, ConcurrentSavesNeverInterleave)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    for (int i = 0; i < 200; ++i)
+        store.set("keys/k" + std::to_string(i), std::string(64, 'x'));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&] {
+            for (int i = 0; i < 20; ++i)
+                EXPECT_TRUE(store.save());
+        });
+    for (auto &t : threads)
+        t.join();
+
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved["keys"].size(), 200u);
+}
+
+TEST_F(SaveAsyncTest, DestructorServesQueuedRequest)
+{
+    std::future<bool> done;
+    {
+        config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+        store.set("a", 1);
+        done = store.save_async();
+    }
+    EXPECT_TRUE(done.get());
+    EXPECT_TRUE(std::filesystem::exists(path));
+}
+
+// ===== Journal Tests =====
+
+struct JournalTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_journal.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".journal");
+        std::filesystem::remove(path + ".journal.old");
+    }
+
+    config::StoreOptions options() const
+    {
+        config::StoreOptions opts;
+        opts.path_type = config::Path::Absolute;
+        opts.journal   = true;
+        return opts;
+    }
+
+    static std::string read_text(const std::string &file)
+    {
+        std::ifstream in(file);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+};
+
+TEST_F(JournalTest, AppendsChangesAndReplaysOnLoad)
+{
+    {
+        config::ConfigStore store(path, options());
+        store.set("server/host", std::string("localhost"));
+        store.set("server/port", 8080);
+        store.set("token", std::string("s3cret"), config::Encoding::Base64);
+        store.remove("server/host");
+        store.remove("server/missing"); // nothing to journal
+        store.merge({{"feature", {{"on", true}}}});
+        store.transaction([](config::Txn &t) {
+            t.set("a", 1);
+            t.set("b", 2);
+        });
+    }
+    EXPECT_FALSE(std::filesystem::exists(path));
+    const std::string journal = read_text(path + ".journal");
+    EXPECT_EQ(std::count(journal.begin(), journal.end(), '\n'), 6);
+    EXPECT_EQ(journal.find("s3cret"), std::string::npos);
+
+    config::ConfigStore reopened(path, options());
+    EXPECT_FALSE(reopened.contains("server/host"));
+    EXPECT_EQ(reopened.get<int>("server/port"), 8080);
+    EXPECT_EQ(reopened.get<std::string>("token"), "s3cret");
+    EXPECT_TRUE(reopened.get<bool>("feature/on"));
+    EXPECT_EQ(reopened.get<int>("b"), 2);
+}
+
+TEST_F(JournalTest, MergeEncodesObfuscatedKeys)
+{
+    {
+        config::ConfigStore store(path, options());
+        store.set("pw", std::string("topsecret"), config::Encoding::Base64);
+        store.merge({{"pw", "hunter2"}, {"user", "admin"}});
+    }
+    const std::string journal = read_text(path + ".journal");
+    EXPECT_EQ(journal.find("topsecret"), std::string::npos);
+    EXPECT_EQ(journal.find("hunter2"), std::string::npos);
+
+    config::ConfigStore reopened(path, options());
+    EXPECT_EQ(reopened.get<std::string>("pw"), "hunter2");
+    EXPECT_EQ(reopened.get<std::string>("user"), "admin");
+}
+
+TEST_F(JournalTest, ReplayKeysEncodingsAsWritten)
+{
+    {
+        config::ConfigStore store(path, options());
+        store.set("/secret", std::string("pw"), config::Encoding::Base64);
+    }
+    {
+        config::ConfigStore reopened(path, options());
+        EXPECT_EQ(reopened.get<std::string>("/secret"), "pw");
+        reopened.set("/secret", std::string("plain"), config::Encoding::None);
+        ASSERT_TRUE(reopened.save());
+    }
+    const auto saved = nlohmann::json::parse(read_text(path));
+    EXPECT_EQ(saved.at("secret"), "plain");
+    EXPECT_TRUE(saved.value("__obfuscate_meta__", nlohmann::json::object()).empty());
+}
+
+TEST_F(JournalTest, RemovingMissingKeyKeepsEncodingEntry)
+{
+    config::ConfigStore store(path, options());
+    store.set("a/pw", std::string("x"), config::Encoding::Base64);
+    store.set("a", 5);
+    store.remove("a/pw"); // a is a scalar now: nothing to erase, nothing journaled
+
+    // Replay would rebuild the map with a/pw still in it, so the live store must keep it too.
+    ASSERT_TRUE(store.save());
+    const auto saved = nlohmann::json::parse(read_text(path));
+    EXPECT_TRUE(saved.at("__obfuscate_meta__").contains("a/pw"));
+}
+
+TEST_F(JournalTest, SaveFoldsJournalIntoFile)
+{
+    config::ConfigStore store(path, options());
+    store.set("x", 1);
+    store.set("y", 2);
+    ASSERT_TRUE(std::filesystem::exists(path + ".journal"));
+
+    EXPECT_TRUE(store.save());
+    EXPECT_FALSE(std::filesystem::exists(path + ".journal"));
+    EXPECT_FALSE(std::filesystem::exists(path + ".journal.old"));
+    store.set("x", 3);
+
+    config::ConfigStore reopened(path, options());
+    EXPECT_EQ(reopened.get<int>("x"), 3);
+    EXPECT_EQ(reopened.get<int>("y"), 2);
+}
+
+TEST_F(JournalTest, CompactsInBackgroundPastThreshold)
+{
+    auto opts                  = options();
+    opts.journal_compact_bytes = 512;
+    opts.save_quiet_period     = std::chrono::milliseconds(10);
+    config::ConfigStore store(path, opts);
+    for (int i = 0; i < 40; ++i)
+        store.set("keys/k" + std::to_string(i), i);
+
+    for (int i = 0; i < 100 && !std::filesystem::exists(path); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_TRUE(store.flush());
+    EXPECT_LT(read_text(path + ".journal").size(), 512u);
+
+    config::ConfigStore reopened(path, options());
+    EXPECT_EQ(reopened.get<int>("keys/k39"), 39);
+}
+
+TEST_F(JournalTest, IgnoresTornLastRecord)
+{
+    {
+        config::ConfigStore store(path, options());
+        store.set("kept", 1);
+    }
+    std::ofstream(path + ".journal", std::ios::app) << "[{\"op\":\"add\",\"path\":\"/lost\"";
+
+    {
+        config::ConfigStore reopened(path, options());
+        EXPECT_EQ(reopened.get<int>("kept"), 1);
+        EXPECT_FALSE(reopened.contains("lost"));
+        reopened.set("after", 2);
+    }
+    config::ConfigStore reopened(path, options());
+    EXPECT_EQ(reopened.get<int>("kept"), 1);
+    EXPECT_EQ(reopened.get<int>("after"), 2);
+}
+
+// ===== Group Commit Tests =====
+
+struct GroupCommitTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_group_commit.json";
+    void TearDown() override
+    {
+        std::filesystem::remove_all(path);
+        std::filesystem::remove(path + ".tmp");
+    }
+};
+
+TEST_F(GroupCommitTest, ConcurrentAutoWritersAllReachDisk)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+        threads.emplace_back([&store, t] {
+            for (int i = 0; i < 25; ++i)
+                store.set("t" + std::to_string(t) + "/k" + std::to_string(i), i);
+        });
+    for (auto &t : threads)
+        t.join();
+
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    ASSERT_EQ(saved.size(), 8u);
+    for (const auto &[name, keys] : saved.items())
+        EXPECT_EQ(keys.size(), 25u) << name;
+}
+
+TEST_F(GroupCommitTest, DurabilityLevelsWriteTheFile)
+{
+    for (const auto durability : {config::Durability::Sync, config::Durability::Atomic})
+    {
+        config::StoreOptions opts;
+        opts.path_type  = config::Path::Absolute;
+        opts.durability = durability;
+        config::ConfigStore store(path, opts);
+        store.set("level", static_cast<int>(durability));
+
+        nlohmann::json saved;
+        std::ifstream(path) >> saved;
+        EXPECT_EQ(saved["level"], static_cast<int>(durability));
+        EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+    }
+}
+
+TEST_F(GroupCommitTest, EveryWriterInAFailedGroupGetsSaveError)
+{
+    config::StoreOptions opts;
+    opts.path_type  = config::Path::Absolute;
+    opts.durability = config::Durability::Atomic;
+    config::ConfigStore store(path, opts);
+    std::filesystem::create_directories(path); // the file can no longer be replaced
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&, t] {
+            try
+            {
+                store.set("k" + std::to_string(t), t);
+            }
+            catch (const config::SaveError &)
+            {
+                ++failures;
+            }
+        });
+    for (auto &t : threads)
+        t.join();
+
+    EXPECT_EQ(failures, 4);
+    EXPECT_EQ(store.get<int>("k3"), 3);
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+}
+
+// ===== Move Set Tests =====
+
+struct MoveSetTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_move_set.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(MoveSetTest, RvalueSetStoresValue)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    std::vector<int> big(1000);
+    std::iota(big.begin(), big.end(), 0);
+    std::string text(4096, 'x');
+
+    store.set("list", std::move(big));
+    store.set("text", std::move(text));
+    store.set(config::key<"nested/text">, std::string("moved"));
+
+    const auto list = store.get<std::vector<int>>("list");
+    ASSERT_EQ(list.size(), 1000u);
+    EXPECT_EQ(list[999], 999);
+    EXPECT_EQ(store.get<std::string>("text").size(), 4096u);
+    EXPECT_EQ(store.get<std::string>("nested/text"), "moved");
+}
+
+TEST_F(MoveSetTest, SetJsonMovesTree)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    nlohmann::json tree = {{"a", {1, 2, 3}}, {"b", {{"c", "d"}}}};
+
+    store.set_json("tree", std::move(tree));
+    EXPECT_TRUE(tree.is_null()); // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(store.get<int>("tree/a/2"), 3);
+    EXPECT_EQ(store.get<std::string>("tree/b/c"), "d");
+
+    store.set_json("", {{"root", true}});
+    EXPECT_TRUE(store.get<bool>("root"));
+    EXPECT_FALSE(store.contains("tree"));
+}
+
+TEST_F(MoveSetTest, MergeRvalueMovesSubtrees)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("server/host", std::string("localhost"));
+    store.set("server/port", 80);
+
+    nlohmann::json overlay = {{"server", {{"port", 8080}}}, {"extra", {1, 2}}};
+    store.merge(std::move(overlay));
+
+    EXPECT_EQ(store.get<std::string>("server/host"), "localhost");
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+    EXPECT_EQ(store.get<int>("extra/1"), 2);
+}
+
+TEST_F(MoveSetTest, ListenersSeeMovedValue)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    nlohmann::json wildcard;
+    std::string keyed;
+    auto all  = store.on_any_change([&](const nlohmann::json &v) { wildcard = v; });
+    auto name = store.on_change<std::string>("name", [&](const std::string &v) { keyed = v; });
+
+    store.set("name", std::string("moved"));
+
+    EXPECT_EQ(wildcard, "moved");
+    EXPECT_EQ(keyed, "moved");
+}
+
+// ===== Update Tests =====
+
+struct UpdateTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_update.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(UpdateTest, ConcurrentIncrementsAreNotLost)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+        threads.emplace_back([&store] {
+            for (int i = 0; i < 500; ++i)
+                store.update<int>("hits", [](int &n) { ++n; });
+        });
+    for (auto &t : threads)
+        t.join();
+
+    EXPECT_EQ(store.get<int>("hits"), 4000);
+    EXPECT_EQ(store.update<int>("hits", [](int &n) { n *= 2; }), 8000);
+}
+
+TEST_F(UpdateTest, StartsFromDefaultAndKeepsEncoding)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set_default("retries", 3);
+    EXPECT_EQ(store.update<int>("retries", [](int &n) { n += 1; }), 4);
+
+    store.set("token", std::string("abc"), config::Encoding::Base64);
+    store.update<std::string>("token", [](std::string &s) { s += "def"; });
+    EXPECT_EQ(store.get<std::string>("token"), "abcdef");
+    ASSERT_TRUE(store.save());
+    std::ifstream in(path);
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(text.find("abcdef"), std::string::npos);
+}
+
+TEST_F(UpdateTest, UpdateJsonAppendsAndNotifies)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    std::vector<int> seen;
+    auto conn = store.on_change<std::vector<int>>("list", [&](const std::vector<int> &v) { seen = v; });
+
+    store.update_json("list", [](nlohmann::json &node) {
+        if (node.is_null())
+            node = nlohmann::json::array();
+        node.push_back(1);
+    });
+    store.update_json("list", [](nlohmann::json &node) { node.push_back(2); });
+
+    EXPECT_EQ(store.get<std::vector<int>>("list"), (std::vector<int>{1, 2}));
+    EXPECT_EQ(seen, (std::vector<int>{1, 2}));
+}
+
+TEST_F(UpdateTest, FailedUpdateLeavesValueUnchanged)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("name", std::string("cfg"));
+
+    EXPECT_THROW(store.update<int>("name", [](int &n) { ++n; }), std::runtime_error);
+    EXPECT_THROW(store.update_json("name", [](nlohmann::json &node) {
+        node = "changed";
+        throw std::logic_error("abort");
+    }),
+                 std::logic_error);
+    EXPECT_THROW(store.update<int>("", [](int &) {}), std::invalid_argument);
+    EXPECT_EQ(store.get<std::string>("name"), "cfg");
+}
+
+// ===== No-op Write Tests =====
+
+struct NoopWriteTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_noop_write.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+    // Overwrites the store's file behind its back, so a later write by the store is detectable.
+    void tamper() const
+    {
+        std::ofstream(path) << R"({"tampered":true})";
+    }
+    bool tampered() const
+    {
+        std::ifstream in(path);
+        return nlohmann::json::parse(in).contains("tampered");
+    }
+};
+
+TEST_F(NoopWriteTest, SaveSkipsUnchangedStore)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("a", 1);
+    ASSERT_TRUE(store.save());
+
+    // An edit keeping the file's size and modification time cannot be told apart from no edit.
+    const auto written = std::filesystem::last_write_time(path);
+    std::string text;
+    std::getline(std::ifstream(path), text, '\0');
+    text.replace(text.find('1'), 1, "2");
+    std::ofstream(path) << text;
+    std::filesystem::last_write_time(path, written);
+    EXPECT_TRUE(store.save());
+    EXPECT_EQ(nlohmann::json::parse(std::ifstream(path))["a"], 2);
+
+    tamper();
+    EXPECT_TRUE(store.save()); // an explicit save repairs an externally edited file
+    EXPECT_FALSE(tampered());
+
+    tamper();
+    EXPECT_TRUE(store.save(config::JsonFormat::Compact)); // a different format is written
+    EXPECT_FALSE(tampered());
+
+    tamper();
+    store.set("a", 2);
+    EXPECT_TRUE(store.save(config::JsonFormat::Compact));
+    EXPECT_FALSE(tampered());
+
+    std::filesystem::remove(path);
+    EXPECT_TRUE(store.save(config::JsonFormat::Compact)); // a missing file is always rewritten
+    EXPECT_TRUE(std::filesystem::exists(path));
+}
+
+TEST_F(NoopWriteTest, EqualSetSkipsNotifyAndAutoSave)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    int calls = 0;
+    auto conn = store.connect("a", [&](const nlohmann::json &) { ++calls; });
+    store.set("a", 1);
+    store.set("s", std::string("x"), config::Encoding::Base64);
+    tamper();
+
+    store.set("a", 1);
+    store.set("s", std::string("x"), config::Encoding::Base64);
+    store.update<int>("a", [](int &) {});
+    store.transaction([](config::Txn &t) { t.set("a", 1); });
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(tampered());
+
+    store.set("s", std::string("x")); // same value, different encoding
+    EXPECT_FALSE(tampered());
+}
+
+TEST_F(NoopWriteTest, EqualMergeAndRootSetSkipSave)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    store.merge({{"server", {{"host", "localhost"}, {"port", 80}}}});
+    tamper();
+
+    store.merge({{"server", {{"port", 80}}}});
+    store.merge(nlohmann::json::object());
+    store.set("", nlohmann::json{{"server", {{"host", "localhost"}, {"port", 80}}}});
+    EXPECT_TRUE(tampered());
+
+    store.merge({{"server", {{"port", 8080}}}});
+    EXPECT_FALSE(tampered());
+    EXPECT_EQ(store.get<int>("server/port"), 8080);
+}
+
+TEST_F(NoopWriteTest, RemovingMissingKeySkipsAutoSave)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    store.set("a", 1);
+    tamper();
+
+    store.remove("missing");
+    store.remove("a/child");
+    EXPECT_TRUE(tampered());
+
+    store.remove("a");
+    EXPECT_FALSE(tampered());
+}
+
+TEST_F(NoopWriteTest, LayeredSetOfInheritedValueStillWrites)
+{
+    config::StoreOptions opts;
+    opts.path_type = config::Path::Absolute;
+    opts.layered   = true;
+    config::ConfigStore store(path, opts);
+    store.set_default("a", 1);
+
+    store.set("a", 1); // equal to the effective value, but not yet held by the runtime layer
+    EXPECT_EQ(store.source_of("a"), "runtime");
+}
+
+// ===== Snapshot Save Tests =====
+
+struct SnapshotSaveTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_snapshot_save.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+};
+
+TEST_F(SnapshotSaveTest, WritersDuringSaveDoNotTearTheFile)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    for (int i = 0; i < 200; ++i)
+        store.set("bulk/k" + std::to_string(i), i);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 2000; ++i)
+            store.set("live/counter", i);
+        done = true;
+    });
+    while (!done)
+    {
+        ASSERT_TRUE(store.save());
+        std::ifstream in(path);
+        const auto saved = nlohmann::json::parse(in);
+        EXPECT_EQ(saved["bulk"].size(), 200u);
+    }
+    writer.join();
+
+    ASSERT_TRUE(store.save());
+    config::ConfigStore reread(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(reread.get<int>("live/counter"), 1999);
+}
+
+TEST_F(SnapshotSaveTest, EncodingsSurviveSharedMapAndRollback)
+{
+    {
+        config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+        store.set("secret", std::string("hunter2"), config::Encoding::Hex);
+        ASSERT_TRUE(store.save());
+        EXPECT_THROW(store.transaction([](config::Txn &t) {
+            t.set("secret", std::string("other"), config::Encoding::Base64);
+            throw std::runtime_error("rollback");
+        }),
+                     std::runtime_error);
+        store.set("plain", 1);
+        ASSERT_TRUE(store.save());
+    }
+    std::ifstream in(path);
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(text.find("hunter2"), std::string::npos);
+
+    config::ConfigStore reread(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(reread.get<std::string>("secret"), "hunter2");
+}
+
+// ===== Streaming Save Tests =====
+
+struct StreamingSaveTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_streaming_save.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".tmp");
+    }
+    std::string read_text() const
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+};
+
+TEST_F(StreamingSaveTest, MatchesDumpLayout)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("text", std::string("quote\" slash\\ tab\t ctl\x01 caf\xc3\xa9"));
+    store.set("nested/list", std::vector<int>{1, -2, 3});
+    store.set("nested/empty_list", std::vector<int>{});
+    store.set_json("nested/empty_object", nlohmann::json::object());
+    store.set("flag", true);
+    store.set_json("nothing", nullptr);
+    store.set("big", std::uint64_t{18446744073709551615ull});
+
+    ASSERT_TRUE(store.save(config::JsonFormat::Pretty));
+    EXPECT_EQ(read_text(), store.get_root<nlohmann::json>().dump(4));
+    ASSERT_TRUE(store.save(config::JsonFormat::Compact));
+    EXPECT_EQ(read_text(), store.get_root<nlohmann::json>().dump());
+}
+
+TEST_F(StreamingSaveTest, LargeDocumentSpansManyChunks)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    for (int i = 0; i < 5000; ++i)
+        store.set("items/k" + std::to_string(i), std::string(40, static_cast<char>('a' + i % 26)));
+    store.set("pi", 3.14159);
+    store.set("secret", std::string("hunter2"), config::Encoding::Base64);
+    ASSERT_TRUE(store.save());
+    EXPECT_GT(std::filesystem::file_size(path), size_t{64} * 1024);
+
+    config::ConfigStore reread(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(reread.get<std::string>("items/k4999"), std::string(40, 'a' + 4999 % 26));
+    EXPECT_DOUBLE_EQ(reread.get<double>("pi"), 3.14159);
+    EXPECT_EQ(reread.get<std::string>("secret"), "hunter2");
+}
+
+TEST_F(StreamingSaveTest, InvalidUtf8FailsWithoutTouchingFile)
+{
+    config::StoreOptions opts;
+    opts.path_type = config::Path::Absolute;
+    opts.save      = config::SaveStrategy::Manual;
+    config::ConfigStore store(path, opts);
+    store.set("ok", 1);
+    ASSERT_TRUE(store.save());
+    const std::string before = read_text();
+
+    store.set("bad", std::string("\xff\xfe"));
+    EXPECT_FALSE(store.save());
+    EXPECT_EQ(read_text(), before);
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+}
+
+TEST_F(StreamingSaveTest, InvalidUtf8AfterFirstChunkKeepsPreviousFile)
+{
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    for (int i = 0; i < 5000; ++i)
+        store.set("items/k" + std::to_string(i), std::string(40, 'x'));
+    ASSERT_TRUE(store.save());
+    const std::string before = read_text();
+    ASSERT_GT(before.size(), size_t{64} * 1024);
+
+    store.set("items/k9", std::string(40, 'y'));
+    store.set("zz", std::string("\xff\xfe")); // sorts after more than a chunk of valid text
+    EXPECT_FALSE(store.save());
+    EXPECT_EQ(read_text(), before);
+}
+
+// ===== Striped Lock Tests =====
+
+struct StripedLockTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_striped_lock.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+    config::StoreOptions options(size_t depth = 1) const
+    {
+        config::StoreOptions opts;
+        opts.path_type    = config::Path::Absolute;
+        opts.save         = config::SaveStrategy::Manual;
+        opts.concurrency  = config::Concurrency::Striped;
+        opts.stripe_depth = depth;
+        return opts;
+    }
+};
+
+TEST_F(StripedLockTest, SectionWritersRunAlongsideReaders)
+{
+    config::ConfigStore store(path, options());
+    store.set("metrics/hits", 0);
+    store.set("routing/hits", 0);
+    const auto metrics = store.compile_key<int>("metrics/hits");
+    const auto routing = store.compile_key<int>("routing/hits");
+
+    std::vector<std::thread> threads;
+    for (const std::string section : {"metrics", "routing"})
+    {
+        threads.emplace_back([&store, section] {
+            for (int i = 1; i <= 2000; ++i)
+            {
+                store.set(section + "/hits", i);
+                store.set(section + "/slot" + std::to_string(i % 8), i);
+            }
+        });
+    }
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+        while (!done)
+        {
+            const auto [m, r] = store.get_many(metrics, routing);
+            EXPECT_GE(m, 0);
+            EXPECT_GE(r, 0);
+            EXPECT_TRUE(nlohmann::json::parse(store.dump()).is_object());
+        }
+    });
+    for (auto &t : threads)
+        t.join();
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(store.get<int>("metrics/hits"), 2000);
+    EXPECT_EQ(store.get<int>("routing/hits"), 2000);
+    ASSERT_TRUE(store.save());
+    config::ConfigStore reread(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(reread.get<int>("routing/slot0"), 2000);
+}
+
+TEST_F(StripedLockTest, StructuralAndSpecialWritesKeepWorking)
+{
+    config::ConfigStore store(path, options(2));
+    std::vector<int> seen;
+    auto conn = store.connect("a/b/c", [&seen](const nlohmann::json &value) { seen.push_back(value.get<int>()); });
+    store.set("a/b/c", 1); // creates the section
+    store.set("a/b/c", 2); // writes inside it
+    store.set("a/b/secret", std::string("hunter2"), config::Encoding::Hex);
+    store.update<int>("a/b/c", [](int &v) { v *= 10; });
+    EXPECT_EQ(seen, (std::vector<int>{1, 2, 20}));
+    EXPECT_EQ(store.get<std::string>("a/b/secret"), "hunter2");
+
+    const auto live = store.live<int>("a/b/c");
+    store.set("a/b/c", 21);
+    EXPECT_EQ(live.load(), 21);
+
+    store.remove("a/b/c");
+    EXPECT_FALSE(store.contains("a/b/c"));
+    store.remove("a/b");
+    EXPECT_FALSE(store.contains("a/b"));
+    EXPECT_EQ(store.get_or_set("a/x/y", 5), 5);
+    EXPECT_EQ(store.keys("a"), (std::vector<std::string>{"x"}));
+}
+
+TEST_F(StripedLockTest, SectionsSharingAnAncestorWriteConcurrently)
+{
+    config::ConfigStore store(path, options(2));
+    const std::vector<std::string> sections{"a/x", "a/y~1z", "a/w"};
+    for (const auto &section : sections)
+        store.set(section + "/n", 0);
+
+    std::vector<std::thread> threads;
+    for (const auto &section : sections)
+    {
+        threads.emplace_back([&store, section] {
+            for (int i = 1; i <= 2000; ++i)
+            {
+                store.set(section + "/n", i);
+                store.set(section + "/tmp/k", i);
+                store.remove(section + "/tmp/k");
+            }
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &section : sections)
+    {
+        EXPECT_EQ(store.get<int>(section + "/n"), 2000);
+        EXPECT_FALSE(store.contains(section + "/tmp/k"));
+    }
+    EXPECT_EQ(store.keys("a"), (std::vector<std::string>{"w", "x", "y/z"}));
+}
+
+TEST_F(StripedLockTest, SectionWritesAreSavedAndElided)
+{
+    config::ConfigStore store(path, options());
+    store.set("metrics/hits", 1);
+    ASSERT_TRUE(store.save());
+    store.set("metrics/hits", 2);
+    store.set("metrics/hits", 2);
+    ASSERT_TRUE(store.save());
+
+    config::ConfigStore reread(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(reread.get<int>("metrics/hits"), 2);
+}
+
+// ===== Binary Format Tests =====
+
+struct BinaryFormatTest : ::testing::Test
+{
+    std::string path    = std::filesystem::temp_directory_path().string() + "/test_binary_format.bin";
+    std::string overlay = std::filesystem::temp_directory_path().string() + "/test_binary_overlay.bin";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(overlay);
+    }
+    config::StoreOptions options(config::FileFormat format) const
+    {
+        config::StoreOptions opts;
+        opts.path_type   = config::Path::Absolute;
+        opts.save        = config::SaveStrategy::Manual;
+        opts.file_format = format;
+        return opts;
+    }
+    std::string read_bytes(const std::string &file) const
+    {
+        std::ifstream in(file, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+};
+
+TEST_F(BinaryFormatTest, EveryFormatRoundTripsWithEncodings)
+{
+    for (const auto format : {config::FileFormat::MessagePack, config::FileFormat::Cbor, config::FileFormat::Bson,
+                              config::FileFormat::Ubjson})
+    {
+        {
+            config::ConfigStore store(path, options(format));
+            store.set("server/port", 8080);
+            store.set("server/hosts", std::vector<std::string>{"a", "b"});
+            store.set("ratio", 0.25);
+            store.set("secret", std::string("hunter2"), config::Encoding::Base64);
+            ASSERT_TRUE(store.save());
+        }
+        const std::string bytes = read_bytes(path);
+        EXPECT_EQ(bytes.find("hunter2"), std::string::npos);
+        EXPECT_FALSE(nlohmann::json::accept(bytes));
+
+        config::ConfigStore reread(path, options(format));
+        EXPECT_EQ(reread.get<int>("server/port"), 8080);
+        EXPECT_EQ(reread.get<std::vector<std::string>>("server/hosts"), (std::vector<std::string>{"a", "b"}));
+        EXPECT_DOUBLE_EQ(reread.get<double>("ratio"), 0.25);
+        EXPECT_EQ(reread.get<std::string>("secret"), "hunter2");
+        EXPECT_FALSE(reread.contains("__obfuscate_meta__"));
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_F(BinaryFormatTest, MergeFileAndLoadLayeredUseTheStoreFormat)
+{
+    const auto bytes = nlohmann::json::to_cbor({{"server", {{"port", 9090}}}, {"extra", true}});
+    std::ofstream(overlay, std::ios::binary).write(reinterpret_cast<const char *>(bytes.data()),
+                                                   static_cast<std::streamsize>(bytes.size()));
+
+    config::ConfigStore store(path, options(config::FileFormat::Cbor));
+    store.set("server/host", std::string("localhost"));
+    store.merge_file(overlay, config::Path::Absolute);
+    EXPECT_EQ(store.get<int>("server/port"), 9090);
+    EXPECT_EQ(store.get<std::string>("server/host"), "localhost");
+
+    store.clear();
+    store.load_layered({overlay}, config::Path::Absolute);
+    EXPECT_TRUE(store.get<bool>("extra"));
+}
+
+TEST_F(BinaryFormatTest, JsonIsStillTheDefault)
+{
+    {
+        config::StoreOptions opts;
+        opts.path_type = config::Path::Absolute;
+        opts.save      = config::SaveStrategy::Manual;
+        config::ConfigStore store(path, opts);
+        store.set("key", 1);
+        ASSERT_TRUE(store.save());
+    }
+    EXPECT_EQ(nlohmann::json::parse(read_bytes(path))["key"], 1);
+}
+
+// ===== File Read Tests =====
+
+struct FileReadTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_file_read.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+    void write(const std::string &text) const
+    {
+        std::ofstream(path, std::ios::binary) << text;
+    }
+};
+
+TEST_F(FileReadTest, LargeFileWithByteOrderMarkLoadsWhole)
+{
+    nlohmann::json doc;
+    for (int i = 0; i < 4000; ++i)
+        doc["items"]["k" + std::to_string(i)] = std::string(30, 'x');
+    doc["last"] = "end";
+    write("\xEF\xBB\xBF" + doc.dump(4));
+    ASSERT_GT(std::filesystem::file_size(path), size_t{64} * 1024);
+
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(store.get<std::string>("last"), "end");
+    EXPECT_EQ(store.keys("items").size(), 4000u);
+}
+
+TEST_F(FileReadTest, MalformedMergeFileThrowsAndLeavesStoreIntact)
+{
+    config::ConfigStore store(std::filesystem::temp_directory_path().string() + "/test_file_read_store.json",
+                              config::Path::Absolute, config::SaveStrategy::Manual);
+    store.set("kept", 1);
+    write("{\"a\": 1");
+    EXPECT_THROW(store.merge_file(path, config::Path::Absolute), nlohmann::json::parse_error);
+    write("[1, ");
+    EXPECT_THROW(store.merge_file(path, config::Path::Absolute), nlohmann::json::parse_error);
+    EXPECT_EQ(store.get<int>("kept"), 1);
+    EXPECT_FALSE(store.contains("a"));
+}
+
+TEST_F(FileReadTest, TrailingContentAfterTheDocumentIsIgnored)
+{
+    write("{\"a\": 1, \"b\": {\"c\": 2}}\n{\"record\": 2}\ngarbage");
+    for (const bool lazy : {false, true})
+    {
+        config::StoreOptions opts;
+        opts.path_type     = config::Path::Absolute;
+        opts.lazy_sections = lazy;
+        config::ConfigStore store(path, opts);
+        EXPECT_EQ(store.get<int>("a"), 1);
+        EXPECT_EQ(store.get<int>("b/c"), 2);
+    }
+
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Auto);
+    store.set("d", 3); // rewrites the file from what was loaded, not from an empty store
+    nlohmann::json saved;
+    std::ifstream(path) >> saved;
+    EXPECT_EQ(saved, (nlohmann::json{{"a", 1}, {"b", {{"c", 2}}}, {"d", 3}}));
+
+    config::ConfigStore merged(std::filesystem::temp_directory_path().string() + "/test_file_read_store.json",
+                               config::Path::Absolute, config::SaveStrategy::Manual);
+    write("{\"x\": 1} trailing");
+    merged.merge_file(path, config::Path::Absolute);
+    EXPECT_EQ(merged.get<int>("x"), 1);
+}
+
+// ===== Lazy Section Tests =====
+
+struct LazySectionTest : ::testing::Test
+{
+    std::string path = std::filesystem::temp_directory_path().string() + "/test_lazy_sections.json";
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+    void write(const std::string &text) const
+    {
+        std::ofstream(path, std::ios::binary) << text;
+    }
+    std::string read() const
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    config::StoreOptions options() const
+    {
+        config::StoreOptions opts;
+        opts.path_type     = config::Path::Absolute;
+        opts.save          = config::SaveStrategy::Manual;
+        opts.lazy_sections = true;
+        return opts;
+    }
+};
+
+TEST_F(LazySectionTest, UntouchedSectionsAreSavedVerbatim)
+{
+    write(R"({"a": {"x": 1}, "b": {"y":   [1,2,  3]}, "n": 5})");
+    {
+        config::ConfigStore store(path, options());
+        EXPECT_EQ(store.get<int>("a/x"), 1);
+        EXPECT_EQ(store.get<int>("n"), 5);
+        store.set("a/x", 2);
+        ASSERT_TRUE(store.save());
+    }
+    EXPECT_NE(read().find(R"("b": {"y":   [1,2,  3]})"), std::string::npos);
+
+    config::ConfigStore store(path, options());
+    EXPECT_EQ(store.get<int>("a/x"), 2);
+    EXPECT_EQ(store.get<std::vector<int>>("b/y"), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(nlohmann::json::parse(store.dump()),
+              nlohmann::json::parse(R"({"a": {"x": 2}, "b": {"y": [1, 2, 3]}, "n": 5})"));
+}
+
+TEST_F(LazySectionTest, SectionsParseOnFirstAccess)
+{
+    {
+        config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+        store.set("secret/token", std::string("abc"), config::Encoding::Base64);
+        store.set("c/kept", 1);
+        store.set("d/list", std::vector<int>{4, 5});
+        store.set("e/gone", true);
+        ASSERT_TRUE(store.save());
+    }
+    {
+        config::ConfigStore store(path, options());
+        EXPECT_EQ(store.keys("d"), std::vector<std::string>{"list"});
+        EXPECT_EQ(store.sub("d")["list"].size(), 2u);
+        EXPECT_TRUE(store.contains("c/kept"));
+        store.merge(nlohmann::json{{"c", {{"added", 2}}}});
+        EXPECT_EQ(store.get<int>("c/kept"), 1);
+        store.remove("e/gone");
+        EXPECT_EQ(store.get_or_set("f/new", 7), 7);
+        ASSERT_TRUE(store.save());
+    }
+    config::ConfigStore store(path, config::Path::Absolute, config::SaveStrategy::Manual);
+    EXPECT_EQ(store.get<std::string>("secret/token"), "abc");
+    EXPECT_EQ(store.get<int>("c/added"), 2);
+    EXPECT_FALSE(store.contains("e/gone"));
+    EXPECT_EQ(store.get<int>("f/new"), 7);
+    EXPECT_EQ(nlohmann::json::parse(read()).at("secret").at("token"), "YWJj");
+}
+
+TEST_F(LazySectionTest, MalformedFileIsRejectedLikeAnEagerLoad)
+{
+    const std::vector<std::string> malformed{
+        R"({"good": {"v": 1}, "bad": {"v": tru}})",
+        R"({"good": {"v": 1}, "a": {"x": 1,,}})",
+        R"({"good": {"v": 1}, "a": {"s": "\uDC00"}})",
+        "{\"good\": {\"v\": 1}, \"a\": {\"s\": \"\xC3\"}}",
+    };
+    for (const auto &text : malformed)
+    {
+        write(text);
+        config::ConfigStore eager(path, config::Path::Absolute, config::SaveStrategy::Manual);
+        config::ConfigStore lazy(path, options());
+        EXPECT_FALSE(eager.contains("good/v")) << text;
+        EXPECT_FALSE(lazy.contains("good/v")) << text;
+    }
+
+    write(R"({"good": {"v": [1, -2.5e3, true, null, "\u00e9\ud83d\ude00"]}, "a": {"x": {}}})");
+    config::ConfigStore lazy(path, options());
+    EXPECT_EQ(lazy.sub("good"), nlohmann::json::parse(R"({"v": [1, -2.5e3, true, null, "\u00e9\ud83d\ude00"]})"));
+}